@@ -0,0 +1,19 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/experimental/types.hpp>
+namespace hana = boost::hana;
+
+
+template <int>
+struct x;
+
+int main() {
+    constexpr auto types = hana::experimental::types<
+        <%= (1..input_size).map { |n| "x<#{n}>" }.join(', ') %>
+    >{};
+    constexpr auto result = hana::at_c<<%= input_size-1 %>>(types);
+    (void)result;
+}
@@ -0,0 +1,38 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/string_lookup.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+<%
+    keys = (1..input_size).map { |i| "field_#{i}" }
+    queries = (keys + keys.map { |k| k + "x" }).shuffle(random: Random.new(input_size))
+    def hana_string(s)
+        "boost::hana::string_c<#{s.chars.map { |c| "'#{c}'" }.join(", ")}>"
+    end
+%>
+
+int main() {
+    constexpr auto lookup = boost::hana::experimental::make_string_lookup(
+        boost::hana::make_tuple(<%= keys.map { |k| hana_string(k) }.join(', ') %>)
+    );
+
+    std::vector<std::string> queries{<%= queries.map { |q| "\"#{q}\"" }.join(', ') %>};
+
+    boost::hana::benchmark::measure([&] {
+        std::size_t result = 0;
+        for (int iteration = 0; iteration < 1 << 5; ++iteration) {
+            for (auto const& query : queries)
+                result += lookup.find(query);
+        }
+        volatile std::size_t sink = result; (void)sink;
+    });
+}
@@ -0,0 +1,37 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+<%
+    keys = (1..input_size).map { |i| "field_#{i}" }
+    queries = (keys + keys.map { |k| k + "x" }).shuffle(random: Random.new(input_size))
+    def hana_string(s)
+        "boost::hana::string_c<#{s.chars.map { |c| "'#{c}'" }.join(", ")}>"
+    end
+%>
+
+int main() {
+    std::unordered_map<std::string, std::size_t> lookup{
+        <%= keys.each_with_index.map { |k, i| "{\"#{k}\", #{i}}" }.join(', ') %>
+    };
+
+    std::vector<std::string> queries{<%= queries.map { |q| "\"#{q}\"" }.join(', ') %>};
+
+    boost::hana::benchmark::measure([&] {
+        std::size_t result = 0;
+        for (int iteration = 0; iteration < 1 << 5; ++iteration) {
+            for (auto const& query : queries) {
+                auto it = lookup.find(query);
+                result += it == lookup.end() ? <%= input_size %> : it->second;
+            }
+        }
+        volatile std::size_t sink = result; (void)sink;
+    });
+}
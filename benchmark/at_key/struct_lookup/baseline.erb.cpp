@@ -0,0 +1,25 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+struct S {
+    BOOST_HANA_DEFINE_STRUCT(S,
+        <%= env[:members].times.map { |i| "(int, m#{i})" }.join(",\n        ") %>
+    );
+};
+
+template <typename Key>
+void at_key(S const&, Key const&) { }
+
+int main() {
+    S s{};
+    (void)s;
+    <% (0...input_size).each do |n| %>
+        at_key(s, BOOST_HANA_STRING("m<%= n %>"));
+    <% end %>
+}
@@ -0,0 +1,23 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+struct S {
+    BOOST_HANA_DEFINE_STRUCT(S,
+        <%= env[:members].times.map { |i| "(int, m#{i})" }.join(",\n        ") %>
+    );
+};
+
+int main() {
+    S s{};
+    (void)s;
+    <% (0...input_size).each do |n| %>
+        hana::at_key(s, BOOST_HANA_STRING("m<%= n %>"));
+    <% end %>
+}
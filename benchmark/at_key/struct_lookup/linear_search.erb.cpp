@@ -0,0 +1,38 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/find_if.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/functional/on.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+struct S {
+    BOOST_HANA_DEFINE_STRUCT(S,
+        <%= env[:members].times.map { |i| "(int, m#{i})" }.join(",\n        ") %>
+    );
+};
+
+// This is how at_key used to look up the members of a Struct.
+template <typename Key>
+int& at_key(S& s, Key const& key) {
+    auto accessor = hana::second(*hana::find_if(hana::accessors<S>(),
+        hana::equal.to(key) ^hana::on^ hana::first
+    ));
+    return accessor(s);
+}
+
+int main() {
+    S s{};
+    (void)s;
+    <% (0...input_size).each do |n| %>
+        at_key(s, BOOST_HANA_STRING("m<%= n %>"));
+    <% end %>
+}
@@ -0,0 +1,23 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/count_if.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+template <typename N>
+struct is_even : std::integral_constant<bool, N::value % 2 == 0> { };
+
+int main() {
+    constexpr auto ints = hana::experimental::types<
+        <%= (1..input_size).map { |n| "hana::int_<#{n}>" }.join(', ') %>
+    >{};
+    constexpr auto result = hana::count_if(ints, hana::metafunction<is_even>);
+    (void)result;
+}
@@ -0,0 +1,27 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/find_if.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+
+// This is the same as compile.hana.tuple.erb.cpp, except it is meant to be
+// run on much longer tuples, to make sure `find_if` does not require an
+// instantiation depth proportional to the size of the tuple.
+struct is_last {
+    template <typename N>
+    constexpr auto operator()(N) const {
+        return boost::hana::bool_c<N::value == <%= input_size %>>;
+    }
+};
+
+int main() {
+    constexpr auto tuple = boost::hana::tuple_c<int,
+        <%= (1..input_size).to_a.join(', ') %>
+    >;
+    constexpr auto result = boost::hana::find_if(tuple, is_last{});
+    (void)result;
+}
@@ -0,0 +1,25 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/ext/std/vector.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/plus.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <vector>
+
+
+int main () {
+    boost::hana::benchmark::measure([] {
+        long long result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            std::vector<int> values = {
+                <%= input_size.times.map { 'std::rand()' }.join(', ') %>
+            };
+
+            result += boost::hana::fold_left(values, 0, boost::hana::plus);
+        }
+    });
+}
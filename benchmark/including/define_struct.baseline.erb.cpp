@@ -0,0 +1,12 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/define_struct.hpp>
+
+
+struct S {
+    <%= input_size.times.map { |i| "int m#{i};" }.join("\n    ") %>
+};
+
+int main() { }
@@ -0,0 +1,13 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/define_struct.hpp>
+
+
+struct S {
+    BOOST_HANA_DEFINE_STRUCT(S<%= input_size.times.map { |i| ",\n        (int, m#{i})" }.join %>
+    );
+};
+
+int main() { }
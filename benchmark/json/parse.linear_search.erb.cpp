@@ -0,0 +1,72 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/json.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/string.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <string>
+namespace hana = boost::hana;
+
+
+struct S {
+    BOOST_HANA_DEFINE_STRUCT(S,
+        <%= input_size.times.map { |i| i.even? ? "(int, m#{i})" : "(std::string, m#{i})" }.join(",\n        ") %>
+    );
+};
+
+S make_s() {
+    return S{
+        <%= input_size.times.map { |i| i.even? ? "#{i * 1000003}" : "std::string(16, 'a' + #{i % 26})" }.join(",\n        ") %>
+    };
+}
+
+// Same as hana::experimental::from_json, except the key of each member
+// is compared with the name of every member in turn.
+char const* parse(char const* first, char const* last, S& s) {
+    if (*first++ != '{')
+        return nullptr;
+    while (true) {
+        char const* key = ++first;
+        first = std::strchr(first, '"');
+        std::size_t length = static_cast<std::size_t>(first - key);
+        first += 2;
+
+        bool found = false;
+        hana::for_each(hana::keys(s), [&](auto name) {
+            if (!found && length == hana::length(name) &&
+                std::memcmp(key, hana::to<char const*>(name), length) == 0)
+            {
+                found = true;
+                first = hana::experimental::from_json(first, last, hana::at_key(s, name));
+            }
+        });
+        if (!found || !first)
+            return nullptr;
+        if (*first == '}')
+            return first + 1;
+        ++first;
+    }
+}
+
+int main() {
+    std::string json;
+    boost::hana::experimental::to_json(std::back_inserter(json), make_s());
+    S s{};
+
+    boost::hana::benchmark::measure([&] {
+        std::size_t result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration)
+            result += static_cast<std::size_t>(parse(json.data(), json.data() + json.size(), s) - json.data());
+        volatile std::size_t sink = result; (void)sink;
+    });
+}
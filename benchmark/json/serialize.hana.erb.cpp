@@ -0,0 +1,39 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/json.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <iterator>
+#include <string>
+
+
+struct S {
+    BOOST_HANA_DEFINE_STRUCT(S,
+        <%= input_size.times.map { |i| i.even? ? "(int, m#{i})" : "(std::string, m#{i})" }.join(",\n        ") %>
+    );
+};
+
+S make_s() {
+    return S{
+        <%= input_size.times.map { |i| i.even? ? "#{i * 1000003}" : "std::string(16, 'a' + #{i % 26})" }.join(",\n        ") %>
+    };
+}
+
+int main() {
+    S s = make_s();
+    std::string json;
+
+    boost::hana::benchmark::measure([&] {
+        std::size_t result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            json.clear();
+            boost::hana::experimental::to_json(std::back_inserter(json), s);
+            result += json.size();
+        }
+        volatile std::size_t sink = result; (void)sink;
+    });
+}
@@ -0,0 +1,69 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/fold.hpp>
+#include <boost/hana/functional/placeholder.hpp>
+#include <boost/hana/intersperse.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/transform.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+namespace hana = boost::hana;
+
+
+struct S {
+    BOOST_HANA_DEFINE_STRUCT(S,
+        <%= input_size.times.map { |i| i.even? ? "(int, m#{i})" : "(std::string, m#{i})" }.join(",\n        ") %>
+    );
+};
+
+S make_s() {
+    return S{
+        <%= input_size.times.map { |i| i.even? ? "#{i * 1000003}" : "std::string(16, 'a' + #{i % 26})" }.join(",\n        ") %>
+    };
+}
+
+// This is the serializer presented in the tutorial.
+template <typename Xs>
+std::string join(Xs&& xs, std::string sep) {
+    return hana::fold(hana::intersperse(std::forward<Xs>(xs), sep), "", hana::_ + hana::_);
+}
+
+std::string quote(std::string s) { return "\"" + s + "\""; }
+
+template <typename T>
+auto to_json(T const& x) -> decltype(std::to_string(x)) {
+    return std::to_string(x);
+}
+
+std::string to_json(std::string s) { return quote(s); }
+
+template <typename T>
+    std::enable_if_t<hana::Struct<T>::value,
+std::string> to_json(T const& x) {
+    auto json = hana::transform(hana::keys(x), [&](auto name) {
+        auto const& member = hana::at_key(x, name);
+        return quote(hana::to<char const*>(name)) + " : " + to_json(member);
+    });
+
+    return "{" + join(std::move(json), ", ") + "}";
+}
+
+int main() {
+    S s = make_s();
+
+    boost::hana::benchmark::measure([&] {
+        std::size_t result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration)
+            result += to_json(s).size();
+        volatile std::size_t sink = result; (void)sink;
+    });
+}
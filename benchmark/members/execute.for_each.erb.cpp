@@ -0,0 +1,34 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/second.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <string>
+
+
+struct S {
+    BOOST_HANA_DEFINE_STRUCT(S,
+        <%= input_size.times.map { |i| "(std::string, m#{i})" }.join(",\n        ") %>
+    );
+};
+
+int main() {
+    S s{
+        <%= input_size.times.map { |i| "std::string(32, 'a' + #{i % 26})" }.join(",\n        ") %>
+    };
+
+    boost::hana::benchmark::measure([&] {
+        std::size_t result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            boost::hana::for_each(s, [&](auto const& member) {
+                result += boost::hana::second(member).size();
+            });
+        }
+        volatile std::size_t sink = result; (void)sink;
+    });
+}
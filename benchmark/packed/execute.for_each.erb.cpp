@@ -0,0 +1,59 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/members.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+
+// The members are declared by groups of decreasing alignment, as is usual
+// for wire records.
+<% types = ["std::uint64_t", "std::uint32_t", "std::uint16_t", "std::uint8_t"] %>
+struct S {
+    BOOST_HANA_DEFINE_STRUCT(S,
+        <%= input_size.times.map { |i| "(#{types[i * 4 / input_size]}, m#{i})" }.join(",\n        ") %>
+    );
+};
+
+unsigned char* pack(unsigned char* out, S const& s) {
+    boost::hana::for_each(boost::hana::members(s), [&](auto const& member) {
+        std::memcpy(out, &member, sizeof(member));
+        out += sizeof(member);
+    });
+    return out;
+}
+
+unsigned char const* unpack(unsigned char const* in, S& s) {
+    boost::hana::for_each_member(s, [&](auto, auto& member) {
+        std::memcpy(&member, in, sizeof(member));
+        in += sizeof(member);
+    });
+    return in;
+}
+
+int main() {
+    constexpr std::size_t size = sizeof(S);
+    std::vector<S> in(1 << 8), out(in.size());
+    std::vector<unsigned char> wire(in.size() * size);
+    for (std::size_t k = 0; k != in.size(); ++k)
+        in[k].m0 = k;
+
+    boost::hana::benchmark::measure([&] {
+        std::size_t result = 0;
+        for (int iteration = 0; iteration < 1 << 4; ++iteration) {
+            for (std::size_t k = 0; k != in.size(); ++k)
+                pack(&wire[k * size], in[k]);
+            for (std::size_t k = 0; k != in.size(); ++k)
+                unpack(&wire[k * size], out[k]);
+            result += out[static_cast<std::size_t>(iteration)].m0;
+        }
+        volatile std::size_t sink = result; (void)sink;
+    });
+}
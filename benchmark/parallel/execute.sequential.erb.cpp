@@ -0,0 +1,36 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstdint>
+
+
+// Each stage has its own type, and does enough work that handing it over
+// to another thread is worth it.
+template <int i>
+struct stage {
+    std::uint64_t state = i;
+
+    void operator()() {
+        for (int k = 0; k != 20000; ++k)
+            state = (state ^ (state >> 29)) * 6364136223846793005ull + 1;
+    }
+};
+
+int main() {
+    auto stages = boost::hana::make_tuple(
+        <%= (1..input_size).map { |i| "stage<#{i}>{}" }.join(', ') %>
+    );
+    auto run = [](auto& stage) { stage(); };
+
+    boost::hana::benchmark::measure([&] {
+        boost::hana::for_each(stages, run);
+    });
+
+    volatile std::uint64_t sink = 0;
+    boost::hana::for_each(stages, [&](auto const& stage) { sink = sink + stage.state; });
+}
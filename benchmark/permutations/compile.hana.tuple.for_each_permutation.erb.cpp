@@ -0,0 +1,22 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/for_each_permutation.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+template <int> struct x { };
+
+struct f {
+    template <typename ...X>
+    constexpr void operator()(X const& ...) const { }
+};
+
+int main() {
+    auto tuple = hana::make_tuple(
+        <%= (1..input_size).map{ |i| "x<#{i}>{}" }.join(', ') %>
+    );
+    hana::for_each_permutation(tuple, f{});
+}
@@ -0,0 +1,39 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/define_struct.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+// Only `price` and `quantity` are looked at; the other members are there
+// to make the rows wider.
+struct S {
+    BOOST_HANA_DEFINE_STRUCT(S,
+        (double, price),
+        (std::int32_t, quantity)<%= (2...input_size).map { |i| ",\n        (double, m#{i})" }.join %>
+    );
+};
+
+int main() {
+    std::vector<S> rows(1 << 15);
+    for (std::size_t i = 0; i != rows.size(); ++i) {
+        rows[i].price = i * 0.25;
+        rows[i].quantity = static_cast<std::int32_t>(i % 100);
+    }
+
+    double result = 0;
+    boost::hana::benchmark::measure([&] {
+        double total = 0;
+        for (S const& s : rows)
+            total += s.price;
+        result += total;
+    });
+
+    volatile double sink = result;
+    (void)sink;
+}
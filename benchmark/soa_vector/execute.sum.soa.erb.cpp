@@ -0,0 +1,43 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/soa_vector.hpp>
+#include <boost/hana/string.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdint>
+
+
+// Only `price` and `quantity` are looked at; the other members are there
+// to make the rows wider.
+struct S {
+    BOOST_HANA_DEFINE_STRUCT(S,
+        (double, price),
+        (std::int32_t, quantity)<%= (2...input_size).map { |i| ",\n        (double, m#{i})" }.join %>
+    );
+};
+
+int main() {
+    boost::hana::experimental::soa_vector<S> rows(1 << 15);
+    auto prices = rows.column(BOOST_HANA_STRING("price"));
+    auto quantities = rows.column(BOOST_HANA_STRING("quantity"));
+    std::size_t const n = rows.size();
+    for (std::size_t i = 0; i != n; ++i) {
+        prices[i] = i * 0.25;
+        quantities[i] = static_cast<std::int32_t>(i % 100);
+    }
+
+    double result = 0;
+    boost::hana::benchmark::measure([&] {
+        double total = 0;
+        for (double price : prices)
+            total += price;
+        result += total;
+    });
+
+    volatile double sink = result;
+    (void)sink;
+}
@@ -0,0 +1,39 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/less.hpp>
+#include <boost/hana/sort.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <utility>
+namespace hana = boost::hana;
+
+
+// This measures the insertion sort that `hana::sort` used to be implemented
+// with, and that it still uses for short sequences.
+template <typename Xs, std::size_t ...i>
+constexpr auto insertion_sort(Xs const& xs, std::index_sequence<i...>, int) {
+    return hana::make_tuple(hana::at_c<i>(xs)...);
+}
+
+template <typename Xs, std::size_t ...i>
+constexpr auto insertion_sort(Xs const& xs, std::index_sequence<i...>) {
+    using Pred = hana::detail::sort_predicate<Xs const&, decltype(hana::less)>;
+    return insertion_sort(xs, typename hana::detail::insertion_sort_impl<
+        Pred, std::index_sequence<>, i...
+    >::type{}, 0);
+}
+
+int main() {
+    constexpr auto tuple = hana::make_tuple(
+        <%= (1..input_size).to_a.shuffle(random: Random.new(input_size))
+                           .map { |n| "hana::int_c<#{n}>" }.join(', ') %>
+    );
+    constexpr auto result = insertion_sort(tuple,
+                                std::make_index_sequence<<%= input_size %>>{});
+    (void)result;
+}
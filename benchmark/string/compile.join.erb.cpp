@@ -0,0 +1,26 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+<%
+    words = %w(orders quotes eu us fills cancels)
+    text = ""
+    text << words[text.size % words.size] << "." while text.size < input_size
+    text = text[0...input_size]
+%>
+
+int main() {
+    constexpr auto parts = hana::make_tuple(
+        <%= text.split('.').map { |word|
+            "hana::string_c<#{word.chars.map { |c| "'#{c}'" }.join(', ')}>"
+        }.join(', ') %>
+    );
+    constexpr auto result = hana::join(parts, hana::char_c<'.'>);
+    (void)result;
+}
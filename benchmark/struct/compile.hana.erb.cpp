@@ -0,0 +1,53 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/any_of.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/find.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/members.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/unpack.hpp>
+namespace hana = boost::hana;
+
+
+struct count {
+    template <typename ...T>
+    constexpr int operator()(T const& ...) const { return sizeof...(T); }
+};
+
+<% structs = 10; members = 10 %>
+<% structs.times do |s| %>
+struct S<%= s %> {
+    BOOST_HANA_DEFINE_STRUCT(S<%= s %>,
+        <%= members.times.map { |m| "(int, m#{m})" }.join(",\n        ") %>
+    );
+};
+constexpr S<%= s %> s<%= s %>{<%= members.times.map { |m| s * members + m }.join(', ') %>};
+<% end %>
+
+<% members.times do |m| %>
+constexpr auto m<%= m %> = hana::string_c<'m', '<%= m %>'>;
+<% end %>
+
+<%
+  operations = [
+    ->(s, m) { "hana::at_key(s#{s}, m#{m}) == #{s * members + m}" },
+    ->(s, m) { "decltype(hana::length(hana::keys(s#{s})))::value == #{members}" },
+    ->(s, m) { "hana::length(hana::members(s#{s})) == hana::size_c<#{members}>" },
+    ->(s, m) { "hana::equal(s#{s}, s#{s})" },
+    ->(s, m) { "hana::any_of(s#{s}, hana::equal.to(m#{m}))" },
+    ->(s, m) { "hana::unpack(s#{s}, count{}) == #{members}" },
+    ->(s, m) { "*hana::find(s#{s}, m#{m}) == #{s * members + m}" }
+  ]
+%>
+
+int main() {
+<% input_size.times do |i| %>
+    static_assert(<%= operations[i % operations.size].call(i % structs, (i / structs) % members) %>, "");
+<% end %>
+}
@@ -5,6 +5,7 @@
 #include "measure.hpp"
 #include <algorithm>
 #include <cstdlib>
+#include <iterator>
 #include <vector>
 
 
@@ -19,7 +20,7 @@ int main () {
             std::vector<long long> results;
             results.reserve(<%= input_size %>);
 
-            std::transform(values.begin(), values.end(), results.begin(), [&](auto t) {
+            std::transform(values.begin(), values.end(), std::back_inserter(results), [&](auto t) {
                 return result += t;
             });
         }
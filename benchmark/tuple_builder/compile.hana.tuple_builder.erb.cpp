@@ -0,0 +1,33 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/append.hpp>
+#include <boost/hana/experimental/tuple_builder.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct x { int value; };
+
+struct sum {
+    template <typename ...X>
+    int operator()(X const& ...x) const {
+        int result = 0;
+        int expand[] = {0, (result += x.value)...};
+        (void)expand;
+        return result;
+    }
+};
+
+int main() {
+    auto xs = hana::make_tuple(
+        <%= (1..input_size).map { |n| "x<#{n}>{#{n}}" }.join(', ') %>
+    );
+    auto result = hana::to_tuple(hana::fold_left(xs, hana::experimental::make_tuple_builder(), hana::append));
+    volatile int sink = hana::unpack(result, sum{});
+    (void)sink;
+}
@@ -0,0 +1,78 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/first.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
+
+
+template <int i>
+struct x { int value; };
+
+struct handler {
+    template <int i>
+    int operator()(x<i> const& x) const { return x.value + i; }
+};
+
+struct holder {
+    std::type_info const* type;
+    void const* object;
+};
+
+// This is the `process` function from example/tutorial/quickstart.switchAny.cpp,
+// adapted to `holder` instead of `boost::any`.
+template <typename Default>
+auto process(holder const&, std::type_index const&, Default& default_) {
+    return default_();
+}
+
+template <typename Default, typename Case, typename ...Rest>
+auto process(holder const& a, std::type_index const& t, Default& default_,
+             Case& case_, Rest& ...rest)
+{
+    using T = typename decltype(+boost::hana::first(case_))::type;
+    return t == typeid(T) ? boost::hana::second(case_)(*static_cast<T const*>(a.object))
+                          : process(a, t, default_, rest...);
+}
+
+int main() {
+    auto cases = boost::hana::make_tuple(
+        <%= input_size.times.map { |i| "boost::hana::make_pair(boost::hana::type_c<x<#{i}>>, handler{})" }.join(",\n        ") %>
+    );
+
+    <% input_size.times do |i| %>
+    x<<%= i %>> object<%= i %>{std::rand()};
+    <% end %>
+    holder holders[] = {
+        <%= input_size.times.map { |i| "holder{&typeid(object#{i}), &object#{i}}" }.join(', ') %>
+    };
+
+    std::vector<holder> queries;
+    for (int i = 0; i < 1 << 10; ++i)
+        queries.push_back(holders[static_cast<std::size_t>(std::rand()) % <%= input_size %>]);
+
+    auto default_ = [] { return 0; };
+
+    boost::hana::benchmark::measure([&] {
+        long long result = 0;
+        for (int iteration = 0; iteration < 1 << 5; ++iteration) {
+            for (holder const& a : queries) {
+                result += boost::hana::unpack(cases, [&](auto& ...cases) {
+                    return process(a, *a.type, default_, cases...);
+                });
+            }
+        }
+        volatile long long sink = result; (void)sink;
+    });
+}
@@ -0,0 +1,40 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+<% if input_size > 10 %>
+    #define FUSION_MAX_LIST_SIZE <%= ((input_size + 9) / 10) * 10 %>
+<% end %>
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/ext/boost/fusion/list.hpp>
+#include <boost/hana/length.hpp>
+
+#include <boost/fusion/include/make_list.hpp>
+
+#include <cstddef>
+#include <utility>
+namespace hana = boost::hana;
+
+
+struct f {
+    template <typename ...T>
+    constexpr void operator()(T const& ...) const { }
+};
+
+template <int i>
+struct x { };
+
+// This is what the generic implementation of unpack for Iterables does,
+// which is what was used for this container before it got its own.
+template <typename Xs, typename F, std::size_t ...i>
+void unpack(Xs const& xs, F f, std::index_sequence<i...>) {
+    f(hana::at_c<i>(xs)...);
+}
+
+int main() {
+    auto xs = boost::fusion::make_list(
+        <%= (1..input_size).map { |n| "x<#{n}>{}" }.join(', ') %>
+    );
+    unpack(xs, f{}, std::make_index_sequence<decltype(hana::length(xs))::value>{});
+}
@@ -0,0 +1,35 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/ext/std/tuple.hpp>
+#include <boost/hana/length.hpp>
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+namespace hana = boost::hana;
+
+
+struct f {
+    template <typename ...T>
+    constexpr void operator()(T const& ...) const { }
+};
+
+template <int i>
+struct x { };
+
+// This is what the generic implementation of unpack for Iterables does,
+// which is what was used for this container before it got its own.
+template <typename Xs, typename F, std::size_t ...i>
+void unpack(Xs const& xs, F f, std::index_sequence<i...>) {
+    f(hana::at_c<i>(xs)...);
+}
+
+int main() {
+    auto xs = std::make_tuple(
+        <%= (1..input_size).map { |n| "x<#{n}>{}" }.join(', ') %>
+    );
+    unpack(xs, f{}, std::make_index_sequence<decltype(hana::length(xs))::value>{});
+}
@@ -0,0 +1,29 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+<% if input_size > 10 %>
+    #define FUSION_MAX_LIST_SIZE <%= ((input_size + 9) / 10) * 10 %>
+<% end %>
+
+#include <boost/hana/ext/boost/fusion/list.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <boost/fusion/include/make_list.hpp>
+namespace hana = boost::hana;
+
+
+struct f {
+    template <typename ...T>
+    constexpr void operator()(T const& ...) const { }
+};
+
+template <int i>
+struct x { };
+
+int main() {
+    auto xs = boost::fusion::make_list(
+        <%= (1..input_size).map { |n| "x<#{n}>{}" }.join(', ') %>
+    );
+    hana::unpack(xs, f{});
+}
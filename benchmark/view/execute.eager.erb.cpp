@@ -0,0 +1,69 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/filter.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/transform.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct small { double value; };
+
+// A large object computed from each element, and only kept until it has
+// been summarized.
+template <int i>
+struct large { double data[32]; };
+
+struct expand {
+    template <int i>
+    large<i> operator()(small<i> const& x) const {
+        large<i> result;
+        for (int k = 0; k != 32; ++k)
+            result.data[k] = x.value * k;
+        return result;
+    }
+};
+
+struct is_even {
+    template <int i>
+    constexpr auto operator()(large<i> const&) const
+    { return hana::bool_c<i % 2 == 0>; }
+};
+
+struct summarize {
+    template <int i>
+    double operator()(large<i> const& x) const {
+        double result = 0;
+        for (int k = 0; k != 32; ++k)
+            result += x.data[k];
+        return result;
+    }
+};
+
+int main() {
+    double result = 0;
+    boost::hana::benchmark::measure([&] {
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            auto xs = hana::make_tuple(
+                <%= (1..input_size).map { |n| "small<#{n}>{std::rand() / 1.0}" }.join(', ') %>
+            );
+            // The intermediate sequences are materialized by each algorithm.
+            auto chain = hana::transform(
+                hana::filter(hana::transform(xs, expand{}), is_even{}),
+                summarize{}
+            );
+            result += hana::fold_left(chain, 0.0, [](double state, double x) {
+                return state + x;
+            });
+        }
+    });
+
+    volatile double sink = result;
+    (void)sink;
+}
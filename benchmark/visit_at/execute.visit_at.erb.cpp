@@ -0,0 +1,37 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/visit_at.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+
+template <int i>
+struct x { int value; };
+
+int main() {
+    auto values = boost::hana::make_tuple(
+        <%= input_size.times.map { |i| "x<#{i}>{std::rand()}" }.join(', ') %>
+    );
+
+    std::vector<std::size_t> indices;
+    for (int i = 0; i < 1 << 10; ++i)
+        indices.push_back(static_cast<std::size_t>(std::rand()) % <%= input_size %>);
+
+    boost::hana::benchmark::measure([&] {
+        long long result = 0;
+        for (int iteration = 0; iteration < 1 << 5; ++iteration) {
+            for (std::size_t n : indices) {
+                result += boost::hana::visit_at(values, n, [](auto const& x) {
+                    return x.value;
+                });
+            }
+        }
+        volatile long long sink = result; (void)sink;
+    });
+}
@@ -0,0 +1,61 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/json.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <iterator>
+#include <string>
+namespace hana = boost::hana;
+
+
+struct Car {
+    BOOST_HANA_DEFINE_STRUCT(Car,
+        (std::string, brand),
+        (std::string, model)
+    );
+};
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (std::string, last_name),
+        (int, age),
+        (hana::tuple<Car, Car>, cars)
+    );
+};
+
+int main() {
+    Person john{"John", "Doe", 30, hana::make_tuple(
+        Car{"Audi", "A4"}, Car{"BMW", "Z3"}
+    )};
+
+    // Write to any output iterator; here we append to a std::string.
+    std::string json;
+    hana::experimental::to_json(std::back_inserter(json), john);
+    BOOST_HANA_RUNTIME_CHECK(json ==
+        R"({"name":"John","last_name":"Doe","age":30,)"
+        R"("cars":[{"brand":"Audi","model":"A4"},{"brand":"BMW","model":"Z3"}]})"
+    );
+
+    // Parse it back. The members may appear in any order, and unknown keys
+    // are skipped.
+    std::string input = R"({ "age": 31, "email": "jane@doe.com", "name": "Jane" })";
+    Person jane = john;
+    char const* end = hana::experimental::from_json(
+        input.data(), input.data() + input.size(), jane
+    );
+    BOOST_HANA_RUNTIME_CHECK(end == input.data() + input.size());
+    BOOST_HANA_RUNTIME_CHECK(jane.name == "Jane");
+    BOOST_HANA_RUNTIME_CHECK(jane.last_name == "Doe");
+    BOOST_HANA_RUNTIME_CHECK(jane.age == 31);
+
+    // Errors are reported by returning a null pointer.
+    std::string invalid = R"({"age": "thirty"})";
+    BOOST_HANA_RUNTIME_CHECK(hana::experimental::from_json(
+        invalid.data(), invalid.data() + invalid.size(), jane
+    ) == nullptr);
+}
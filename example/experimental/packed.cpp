@@ -0,0 +1,47 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/packed.hpp>
+
+#include <cstdint>
+namespace hana = boost::hana;
+
+
+struct Message {
+    BOOST_HANA_DEFINE_STRUCT(Message,
+        (std::uint8_t, kind),
+        (std::uint64_t, timestamp),
+        (std::uint16_t, length),
+        (double, price),
+        (std::uint32_t, quantity)
+    );
+};
+
+// The members are laid out by decreasing alignment: timestamp, price,
+// quantity, length and kind, without any padding.
+using Layout = hana::experimental::packed_layout<Message>;
+static_assert(sizeof(Message) == 40, "");
+static_assert(Layout::size == 23, "");
+static_assert(Layout::offset(1) == 0, "");  // timestamp
+static_assert(Layout::offset(3) == 8, "");  // price
+static_assert(Layout::offset(4) == 16, ""); // quantity
+static_assert(Layout::offset(2) == 20, ""); // length
+static_assert(Layout::offset(0) == 22, ""); // kind
+
+int main() {
+    Message message{1, 1234567890, 16, 99.5, 300};
+
+    unsigned char buffer[Layout::size];
+    hana::experimental::to_packed(buffer, message);
+
+    Message copy{};
+    hana::experimental::from_packed(buffer, copy);
+    BOOST_HANA_RUNTIME_CHECK(copy.kind == 1);
+    BOOST_HANA_RUNTIME_CHECK(copy.timestamp == 1234567890);
+    BOOST_HANA_RUNTIME_CHECK(copy.length == 16);
+    BOOST_HANA_RUNTIME_CHECK(copy.price == 99.5);
+    BOOST_HANA_RUNTIME_CHECK(copy.quantity == 300);
+}
@@ -0,0 +1,56 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/parallel.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <string>
+#include <vector>
+namespace hana = boost::hana;
+
+
+// Stages of a pipeline that have nothing in common except for their
+// interface, and that can each take a while to run.
+struct sum_stage {
+    std::vector<int> input;
+    long operator()() const { return std::accumulate(input.begin(), input.end(), 0l); }
+};
+
+struct concat_stage {
+    std::vector<std::string> input;
+    std::string operator()() const { return std::accumulate(input.begin(), input.end(), std::string{}); }
+};
+
+struct count_stage {
+    std::string input;
+    char c;
+    std::size_t operator()() const { return static_cast<std::size_t>(std::count(input.begin(), input.end(), c)); }
+};
+
+int main() {
+    auto stages = hana::make_tuple(
+        sum_stage{{1, 2, 3, 4}},
+        concat_stage{{"abc", "def"}},
+        count_stage{"abracadabra", 'a'}
+    );
+
+    // Run all the stages at once, using the default thread pool.
+    auto results = hana::experimental::transform(hana::experimental::par, stages,
+        [](auto const& stage) { return stage(); });
+
+    BOOST_HANA_RUNTIME_CHECK(results == hana::make_tuple(10l, std::string{"abcdef"}, std::size_t{5}));
+
+    // Or use a pool with a fixed number of threads.
+    hana::experimental::thread_pool pool{2};
+    std::vector<std::string> log(3);
+    hana::experimental::for_each(hana::experimental::par.on(pool), hana::make_tuple(0, 1, 2),
+        [&](int i) { log[i] = std::to_string(i); });
+
+    BOOST_HANA_RUNTIME_CHECK(log == std::vector<std::string>{"0", "1", "2"});
+}
@@ -0,0 +1,44 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/soa_vector.hpp>
+#include <boost/hana/string.hpp>
+
+#include <numeric>
+#include <string>
+namespace hana = boost::hana;
+
+
+struct Order {
+    BOOST_HANA_DEFINE_STRUCT(Order,
+        (std::string, symbol),
+        (double, price),
+        (int, quantity),
+        (bool, buy)
+    );
+};
+
+int main() {
+    hana::experimental::soa_vector<Order> orders;
+    orders.push_back(Order{"ABC", 10.5, 100, true});
+    orders.push_back(Order{"DEF", 20.0, 200, false});
+    orders.push_back(Order{"GHI", 30.5, 300, true});
+
+    // Each member is stored in its own contiguous array, so this loop only
+    // touches the quantities.
+    auto quantities = orders.column(BOOST_HANA_STRING("quantity"));
+    BOOST_HANA_RUNTIME_CHECK(std::accumulate(quantities.begin(), quantities.end(), 0) == 600);
+
+    // Rows are accessed through a proxy, which is a Struct with the same
+    // members as an Order.
+    auto row = orders[1];
+    BOOST_HANA_RUNTIME_CHECK(hana::at_key(row, BOOST_HANA_STRING("symbol")) == "DEF");
+    hana::at_key(row, BOOST_HANA_STRING("price")) = 25.0;
+
+    Order order = orders[1];
+    BOOST_HANA_RUNTIME_CHECK(order.price == 25.0);
+}
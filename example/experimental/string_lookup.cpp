@@ -0,0 +1,59 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/string_lookup.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/transform.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (int, age)
+    );
+};
+
+template <typename T, typename U>
+void assign(T&, U const&) { }
+
+template <typename T>
+void assign(T& member, T const& value) { member = value; }
+
+// Sets the member of `p` with the given name, which is only known at runtime.
+// This could be used when parsing JSON, for example.
+template <typename Value>
+bool set_member(Person& p, std::string const& member, Value const& value) {
+    constexpr auto lookup = hana::experimental::make_string_lookup(
+        hana::transform(hana::accessors<Person>(), hana::first)
+    );
+
+    return lookup.visit(member, [&](auto key) {
+        assign(hana::at_key(p, key), value);
+        return true;
+    }, [] {
+        return false;
+    });
+}
+
+int main() {
+    constexpr auto lookup = hana::experimental::make_string_lookup(
+        hana::transform(hana::accessors<Person>(), hana::first)
+    );
+    static_assert(lookup.find("name", 4) == 0, "");
+    static_assert(lookup.find("age", 3) == 1, "");
+    static_assert(lookup.find("email", 5) == lookup.size(), "");
+
+    Person john{"John", 30};
+    BOOST_HANA_RUNTIME_CHECK(set_member(john, "age", 31));
+    BOOST_HANA_RUNTIME_CHECK(john.age == 31);
+    BOOST_HANA_RUNTIME_CHECK(!set_member(john, "email", 31));
+}
@@ -0,0 +1,33 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/append.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/concat.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/tuple_builder.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+using namespace std::literals;
+
+
+int main() {
+    // Appending to a builder only creates one new type, no matter how many
+    // elements it already holds. The tuple is created once, at the end.
+    auto xs = hana::append(hana::experimental::make_tuple_builder(1, '2'), 3.3);
+    auto ys = hana::append(xs, "4"s);
+    auto tuple = hana::to_tuple(hana::concat(ys, hana::experimental::make_tuple_builder(5u)));
+    BOOST_HANA_RUNTIME_CHECK(tuple == hana::make_tuple(1, '2', 3.3, "4"s, 5u));
+
+    // The usual fold_left + append idiom is linear with a builder.
+    auto strings = hana::to_tuple(hana::fold_left(
+        hana::make_tuple("a"s, "b"s, "c"s),
+        hana::experimental::make_tuple_builder(),
+        hana::append
+    ));
+    BOOST_HANA_RUNTIME_CHECK(strings == hana::make_tuple("a"s, "b"s, "c"s));
+}
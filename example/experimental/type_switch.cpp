@@ -0,0 +1,44 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/type_switch.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <boost/any.hpp>
+#include <string>
+namespace hana = boost::hana;
+using namespace std::literals;
+
+
+int main() {
+    auto sw = hana::experimental::type_switch(hana::make_tuple(
+        hana::make_pair(hana::type_c<int>, [](int i) { return "int: "s + std::to_string(i); }),
+        hana::make_pair(hana::type_c<char>, [](char c) { return "char: "s + c; }),
+        hana::make_pair(hana::type_c<std::string>, [](std::string const& s) { return "string: "s + s; })
+    ));
+
+    auto describe = [&](boost::any& a) {
+        return sw(a.type(), [&](auto t) -> auto& {
+            using T = typename decltype(t)::type;
+            return *boost::unsafe_any_cast<T>(&a);
+        }, [] {
+            return "unknown"s;
+        });
+    };
+
+    boost::any a = 'x';
+    BOOST_HANA_RUNTIME_CHECK(describe(a) == "char: x");
+
+    a = 42;
+    BOOST_HANA_RUNTIME_CHECK(describe(a) == "int: 42");
+
+    a = "abc"s;
+    BOOST_HANA_RUNTIME_CHECK(describe(a) == "string: abc");
+
+    a = 3.5;
+    BOOST_HANA_RUNTIME_CHECK(describe(a) == "unknown");
+}
@@ -0,0 +1,47 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/filter.hpp>
+#include <boost/hana/find_if.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/sort.hpp>
+#include <boost/hana/type.hpp>
+#include <boost/hana/unique.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+template <typename T, typename U>
+struct smaller : std::integral_constant<bool, (sizeof(T) < sizeof(U))> { };
+
+int main() {
+    constexpr auto types = hana::experimental::types<char*, long, char, int*, long>{};
+
+    // Metafunctions are applied to the types directly.
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::filter(types, hana::metafunction<std::is_pointer>),
+        hana::experimental::types<char*, int*>{}
+    ));
+
+    // Functions are called with `hana::type`s.
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find_if(types, hana::trait<std::is_integral>),
+        hana::just(hana::type_c<long>)
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sort(hana::experimental::types<char[3], char[1], char[2]>{},
+                   hana::metafunction<smaller>),
+        hana::experimental::types<char[1], char[2], char[3]>{}
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unique(hana::experimental::types<int, int, char, char, int>{}),
+        hana::experimental::types<int, char, int>{}
+    ));
+}
@@ -0,0 +1,30 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/members.hpp>
+#include <boost/hana/string.hpp>
+
+#include <sstream>
+#include <string>
+namespace hana = boost::hana;
+
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (unsigned short, age)
+    );
+};
+
+int main() {
+    Person john{"John", 30};
+
+    std::ostringstream out;
+    hana::for_each_member(john, [&](auto name, auto const& member) {
+        out << hana::to<char const*>(name) << '=' << member << ';';
+    });
+    BOOST_HANA_RUNTIME_CHECK(out.str() == "name=John;age=30;");
+}
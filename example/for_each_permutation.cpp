@@ -0,0 +1,25 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/for_each_permutation.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <sstream>
+#include <string>
+namespace hana = boost::hana;
+
+
+int main() {
+    // The 6 permutations are never created; the function is called with
+    // the elements of the tuple directly.
+    std::ostringstream ss;
+    hana::for_each_permutation(hana::make_tuple('1', 2, 3.5), [&](auto const& ...x) {
+        using Swallow = int[];
+        (void)Swallow{0, ((void)(ss << x), 0)...};
+        ss << ' ';
+    });
+
+    BOOST_HANA_RUNTIME_CHECK(ss.str() == "123.5 13.52 213.5 23.51 3.512 3.521 ");
+}
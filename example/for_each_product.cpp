@@ -0,0 +1,43 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/for_each_product.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <string>
+#include <typeinfo>
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct row_major { };
+struct column_major { };
+
+template <typename T, typename Layout>
+struct kernel {
+    static std::string name() {
+        return std::string{typeid(T).name()} + "/" + typeid(Layout).name();
+    }
+};
+
+int main() {
+    auto dtypes = hana::tuple_t<float, double, int>;
+    auto layouts = hana::tuple_t<row_major, column_major>;
+
+    // Instantiate a kernel for each (dtype, layout) pair. The 6 pairs are
+    // never created; the function is called with the elements directly.
+    std::vector<std::string> registry;
+    hana::for_each_product(hana::make_tuple(dtypes, layouts), [&](auto t, auto l) {
+        using T = typename decltype(t)::type;
+        using Layout = typename decltype(l)::type;
+        registry.push_back(kernel<T, Layout>::name());
+    });
+
+    BOOST_HANA_RUNTIME_CHECK(registry.size() == 6);
+    BOOST_HANA_RUNTIME_CHECK(registry[0] == (kernel<float, row_major>::name()));
+    BOOST_HANA_RUNTIME_CHECK(registry[1] == (kernel<float, column_major>::name()));
+    BOOST_HANA_RUNTIME_CHECK(registry[5] == (kernel<int, column_major>::name()));
+}
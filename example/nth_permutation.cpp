@@ -0,0 +1,24 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/nth_permutation.hpp>
+#include <boost/hana/permutations.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+constexpr auto xs = hana::make_tuple('1', 2, 3.0);
+
+static_assert(hana::nth_permutation(xs, hana::size_c<0>) == hana::make_tuple('1', 2, 3.0), "");
+static_assert(hana::nth_permutation(xs, hana::size_c<3>) == hana::make_tuple(2, 3.0, '1'), "");
+static_assert(hana::nth_permutation_c<5>(xs) == hana::make_tuple(3.0, 2, '1'), "");
+
+// Only the requested permutation is created, but it is the same as the
+// one found at that position in `permutations(xs)`.
+static_assert(hana::nth_permutation_c<4>(xs) == hana::at_c<4>(hana::permutations(xs)), "");
+
+int main() { }
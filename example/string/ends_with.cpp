@@ -0,0 +1,18 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(
+        hana::ends_with(BOOST_HANA_STRING("orders.eu.fills"), BOOST_HANA_STRING(".fills"))
+    );
+
+    BOOST_HANA_CONSTANT_CHECK(
+        !hana::ends_with(BOOST_HANA_STRING("orders.eu.fills"), BOOST_HANA_STRING(".cancels"))
+    );
+}
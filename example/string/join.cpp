@@ -0,0 +1,27 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    auto parts = hana::make_tuple(
+        BOOST_HANA_STRING("orders"),
+        BOOST_HANA_STRING("eu"),
+        BOOST_HANA_STRING("fills")
+    );
+
+    BOOST_HANA_CONSTANT_CHECK(
+        hana::join(parts, hana::char_c<'.'>) == BOOST_HANA_STRING("orders.eu.fills")
+    );
+
+    BOOST_HANA_CONSTANT_CHECK(
+        hana::join(parts, BOOST_HANA_STRING(", ")) == BOOST_HANA_STRING("orders, eu, fills")
+    );
+}
@@ -0,0 +1,38 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/members.hpp>
+
+#include <string>
+#include <utility>
+namespace hana = boost::hana;
+
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (unsigned short, age)
+    );
+};
+
+int main() {
+    Person john{"John", 30};
+
+    // The members are passed by reference, so they can be modified in place.
+    hana::unpack_members(john, [](std::string& name, unsigned short& age) {
+        name += " Doe";
+        ++age;
+    });
+    BOOST_HANA_RUNTIME_CHECK(john.name == "John Doe");
+    BOOST_HANA_RUNTIME_CHECK(john.age == 31);
+
+    // When the object is an rvalue, so are its members.
+    std::string name = hana::unpack_members(std::move(john),
+        [](std::string&& name, unsigned short&&) {
+            return std::move(name);
+        });
+    BOOST_HANA_RUNTIME_CHECK(name == "John Doe");
+}
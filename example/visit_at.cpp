@@ -0,0 +1,32 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/visit_at.hpp>
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+namespace hana = boost::hana;
+
+
+int main(int argc, char* argv[]) {
+    auto xs = hana::make_tuple(1, '2', std::string{"345"});
+
+    auto to_string = [](auto const& x) {
+        std::ostringstream ss;
+        ss << x;
+        return ss.str();
+    };
+
+    BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, 0, to_string) == "1");
+    BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, 1, to_string) == "2");
+    BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, 2, to_string) == "345");
+
+    // The index may come from anywhere at runtime; the matching element
+    // is reached in constant time, whatever the length of the tuple.
+    int i = argc > 1 ? std::atoi(argv[1]) % 3 : 2;
+    BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, i, to_string).size() == (i == 2 ? 3u : 1u));
+}
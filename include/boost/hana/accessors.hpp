@@ -16,8 +16,33 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 
+#include <type_traits>
+
 
 BOOST_HANA_NAMESPACE_BEGIN
+    namespace struct_detail {
+        // The accessors of the Structs defined with the macros are tuples
+        // of empty objects (the names of the members and pointers to them
+        // as template arguments), so they can be default-constructed from
+        // their type, which is only computed once per Struct. This avoids
+        // building them with `apply()` every time they are used, which is
+        // costly in constant expressions. Other accessors, e.g. those
+        // made of lambdas, are still obtained with `apply()`.
+        template <typename Accessors, typename Type = decltype(Accessors::apply()),
+                  bool = std::is_empty<Type>::value &&
+                         std::is_default_constructible<Type>::value>
+        struct cached_accessors {
+            static constexpr Type get()
+            { return Type{}; }
+        };
+
+        template <typename Accessors, typename Type>
+        struct cached_accessors<Accessors, Type, false> {
+            static constexpr decltype(auto) get()
+            { return Accessors::apply(); }
+        };
+    }
+
     template <typename S>
     struct accessors_t {
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
@@ -30,7 +55,7 @@ BOOST_HANA_NAMESPACE_BEGIN
                 hana::Struct<S>::value
             );
 
-            return Accessors::apply();
+            return struct_detail::cached_accessors<Accessors>::get();
         }
     };
 
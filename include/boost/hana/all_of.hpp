@@ -16,6 +16,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/concept/searchable.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/runtime_sequence.hpp>
 #include <boost/hana/functional/compose.hpp>
 #include <boost/hana/not.hpp>
 
@@ -26,11 +27,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto all_of_t::operator()(Xs&& xs, Pred&& pred) const {
         using S = typename hana::tag_of<Xs>::type;
         using AllOf = BOOST_HANA_DISPATCH_IF(all_of_impl<S>,
-            hana::Searchable<S>::value
+            hana::Searchable<S>::value || detail::runtime_sequence<S>::value
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Searchable<S>::value,
+        static_assert(hana::Searchable<S>::value || detail::runtime_sequence<S>::value,
         "hana::all_of(xs, pred) requires 'xs' to be a Searchable");
     #endif
 
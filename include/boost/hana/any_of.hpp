@@ -20,6 +20,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/concept/struct.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/runtime_sequence.hpp>
 #include <boost/hana/drop_front.hpp>
 #include <boost/hana/first.hpp>
 #include <boost/hana/front.hpp>
@@ -37,11 +38,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto any_of_t::operator()(Xs&& xs, Pred&& pred) const {
         using S = typename hana::tag_of<Xs>::type;
         using AnyOf = BOOST_HANA_DISPATCH_IF(any_of_impl<S>,
-            hana::Searchable<S>::value
+            hana::Searchable<S>::value || detail::runtime_sequence<S>::value
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Searchable<S>::value,
+        static_assert(hana::Searchable<S>::value || detail::runtime_sequence<S>::value,
         "hana::any_of(xs, pred) requires 'xs' to be a Searchable");
     #endif
 
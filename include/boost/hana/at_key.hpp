@@ -14,11 +14,14 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/accessors.hpp>
 #include <boost/hana/at.hpp>
+#include <boost/hana/concept/hashable.hpp>
 #include <boost/hana/concept/searchable.hpp>
 #include <boost/hana/concept/struct.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/hash_table.hpp>
 #include <boost/hana/equal.hpp>
 #include <boost/hana/find.hpp>
 #include <boost/hana/find_if.hpp>
@@ -29,6 +32,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/second.hpp>
 
 #include <cstddef>
+#include <type_traits>
 #include <utility>
 
 
@@ -106,16 +110,74 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    namespace struct_detail {
+        template <typename S>
+        struct KeyAtIndex {
+            template <std::size_t i>
+            using apply = decltype(hana::first(hana::at_c<i>(hana::accessors<S>())));
+        };
+
+        // When all the keys of a Struct are Hashable, we look them up in
+        // a hash table like the one used by `hana::map`, which is computed
+        // once per Struct. Otherwise, `type` is `void` and we fall back to
+        // a linear search.
+        struct no_hash_table { using type = void; };
+
+        template <typename S, typename Indices = std::make_index_sequence<
+            decltype(hana::length(hana::accessors<S>()))::value
+        >>
+        struct hash_table_of;
+
+        template <typename S, std::size_t ...i>
+        struct hash_table_of<S, std::index_sequence<i...>>
+            : std::conditional<
+                detail::fast_and<
+                    hana::Hashable<typename KeyAtIndex<S>::template apply<i>>::value...
+                >::value,
+                detail::make_colliding_hash_table<
+                    KeyAtIndex<S>::template apply, sizeof...(i)
+                >,
+                no_hash_table
+            >::type
+        { };
+
+        template <typename S, typename HashTable>
+        struct at_key_impl {
+            template <typename X, typename Key>
+            static constexpr decltype(auto) apply(X&& x, Key const& key) {
+                auto accessor = hana::second(*hana::find_if(hana::accessors<S>(),
+                    hana::equal.to(key) ^hana::on^ hana::first
+                ));
+                return accessor(static_cast<X&&>(x));
+            }
+        };
+
+        template <typename S, typename ...Buckets>
+        struct at_key_impl<S, detail::hash_table<Buckets...>> {
+            template <typename X, std::size_t i>
+            static constexpr decltype(auto)
+            apply_index(X&& x, hana::optional<std::integral_constant<std::size_t, i>>) {
+                return hana::second(hana::at_c<i>(hana::accessors<S>()))(
+                    static_cast<X&&>(x)
+                );
+            }
+
+            template <typename X, typename Key>
+            static constexpr decltype(auto) apply(X&& x, Key const&) {
+                using MaybeIndex = typename detail::find_index<
+                    detail::hash_table<Buckets...>, Key, KeyAtIndex<S>::template apply
+                >::type;
+                static_assert(!std::is_same<MaybeIndex, hana::optional<>>::value,
+                "hana::at_key(xs, key) requires 'key' to be the key of a member of 'xs'");
+                return apply_index(static_cast<X&&>(x), MaybeIndex{});
+            }
+        };
+    }
+
     template <typename S>
-    struct at_key_impl<S, when<hana::Struct<S>::value>> {
-        template <typename X, typename Key>
-        static constexpr decltype(auto) apply(X&& x, Key const& key) {
-            auto accessor = hana::second(*hana::find_if(hana::accessors<S>(),
-                hana::equal.to(key) ^hana::on^ hana::first
-            ));
-            return accessor(static_cast<X&&>(x));
-        }
-    };
+    struct at_key_impl<S, when<hana::Struct<S>::value>>
+        : struct_detail::at_key_impl<S, typename struct_detail::hash_table_of<S>::type>
+    { };
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_AT_KEY_HPP
@@ -15,6 +15,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/default.hpp>
 #include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/detail/runtime_sequence.hpp>
 #include <boost/hana/fold_left.hpp>
 #include <boost/hana/unpack.hpp>
 
@@ -23,8 +24,9 @@ BOOST_HANA_NAMESPACE_BEGIN
     template <typename T>
     struct Foldable {
         using Tag = typename tag_of<T>::type;
-        static constexpr bool value = !is_default<fold_left_impl<Tag>>::value ||
-                                      !is_default<unpack_impl<Tag>>::value;
+        static constexpr bool value = !detail::runtime_sequence<Tag>::value && (
+                                      !is_default<fold_left_impl<Tag>>::value ||
+                                      !is_default<unpack_impl<Tag>>::value);
     };
 BOOST_HANA_NAMESPACE_END
 
@@ -146,6 +146,15 @@ Distributed under the Boost Software License, Version 1.0.
 #   define BOOST_HANA_CONFIG_LIBCPP_HAS_BUG_22806
 #endif
 
+// BOOST_HANA_CONFIG_HAS_FOLD_EXPRESSIONS is defined when the compiler supports
+// C++17 fold expressions, which are then used to implement variadic folds
+// without recursive template instantiations. Defining
+// BOOST_HANA_CONFIG_DISABLE_FOLD_EXPRESSIONS forces the C++14 implementation.
+#if defined(__cpp_fold_expressions) &&                                      \
+        !defined(BOOST_HANA_CONFIG_DISABLE_FOLD_EXPRESSIONS)
+#   define BOOST_HANA_CONFIG_HAS_FOLD_EXPRESSIONS
+#endif
+
 //////////////////////////////////////////////////////////////////////////////
 // Namespace macros
 //////////////////////////////////////////////////////////////////////////////
@@ -16,6 +16,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/concept/searchable.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/runtime_sequence.hpp>
 #include <boost/hana/equal.hpp>
 
 
@@ -25,11 +26,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto contains_t::operator()(Xs&& xs, Key&& key) const {
         using S = typename hana::tag_of<Xs>::type;
         using Contains = BOOST_HANA_DISPATCH_IF(contains_impl<S>,
-            hana::Searchable<S>::value
+            hana::Searchable<S>::value || detail::runtime_sequence<S>::value
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Searchable<S>::value,
+        static_assert(hana::Searchable<S>::value || detail::runtime_sequence<S>::value,
         "hana::contains(xs, key) requires 'xs' to be a Searchable");
     #endif
 
@@ -10,8 +10,10 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_HAS_DUPLICATES_HPP
 #define BOOST_HANA_DETAIL_HAS_DUPLICATES_HPP
 
+#include <boost/hana/concept/hashable.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/hash_table.hpp>
 #include <boost/hana/equal.hpp>
 
 #include <cstddef>
@@ -32,6 +34,72 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
         return c;
     }
 
+    // Allows retrieving the `i`-th type of a pack in O(1), which is what
+    // `make_colliding_hash_table` expects from its `KeyAtIndex` alias.
+    template <std::size_t i, typename T>
+    struct indexed_type { using type = T; };
+
+    template <std::size_t i, typename T>
+    indexed_type<i, T> type_at_index_impl(indexed_type<i, T> const&);
+
+    template <typename Indices, typename ...T>
+    struct indexed_types;
+
+    template <std::size_t ...i, typename ...T>
+    struct indexed_types<std::index_sequence<i...>, T...>
+        : indexed_type<i, T>...
+    {
+        template <std::size_t n>
+        using apply = typename decltype(
+            detail::type_at_index_impl<n>(std::declval<indexed_types>())
+        )::type;
+    };
+
+    // Returns whether the `T`s with the given indices contain duplicates.
+    // This is used to compare the keys inside each bucket of a hash table.
+    template <typename Types, typename Bucket>
+    struct bucket_has_duplicates;
+
+    template <typename Types, typename Hash, std::size_t ...i>
+    struct bucket_has_duplicates<Types, bucket<Hash, i...>> {
+        static constexpr bool value = !detail::fast_and<(detail::pack_count<
+            typename Types::template apply<i>,
+            typename Types::template apply<i>...
+        >() == 1)...>::value;
+    };
+
+    template <typename Types, typename Hash, std::size_t i>
+    struct bucket_has_duplicates<Types, bucket<Hash, i>> {
+        static constexpr bool value = false;
+    };
+
+    template <typename Types, typename HashTable>
+    struct hash_table_has_duplicates;
+
+    template <typename Types, typename ...Buckets>
+    struct hash_table_has_duplicates<Types, hash_table<Buckets...>> {
+        static constexpr bool value = !detail::fast_and<
+            !bucket_has_duplicates<Types, Buckets>::value...
+        >::value;
+    };
+
+    template <bool AllHashable, typename ...T>
+    struct has_duplicates_impl {
+        static constexpr bool value =
+            sizeof...(T) > 0 &&
+            !detail::fast_and<(detail::pack_count<T, T...>() == 1)...>::value
+        ;
+    };
+
+    template <typename ...T>
+    struct has_duplicates_impl<true, T...> {
+        using Types = indexed_types<std::make_index_sequence<sizeof...(T)>, T...>;
+        using HashTable = typename detail::make_colliding_hash_table<
+            Types::template apply, sizeof...(T)
+        >::type;
+        static constexpr bool value = hash_table_has_duplicates<Types, HashTable>::value;
+    };
+
     //! @ingroup group-details
     //! Returns whether any of the `T`s are duplicate w.r.t. `hana::equal`.
     //!
@@ -41,25 +109,25 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
     //! the comparison to return an `IntegralConstant` that can be explicitly
     //! converted to `bool`.
     //!
+    //! When all the `T`s are `Hashable`, they are first grouped by hash in
+    //! a `detail::hash_table`, and only the `T`s that fall in the same bucket
+    //! are compared with each other. Since equal objects must have equal
+    //! hashes, this is equivalent to comparing every pair of `T`s, but it
+    //! only requires O(n) comparisons when there are no collisions.
+    //! Otherwise, every pair of `T`s is compared, which is O(n^2).
+    //!
     //! @note
     //! Since this utility is mostly used in assertions to check that there
     //! are no duplicates in a sequence, we expect it to return `false` most
     //! of the time (otherwise we will assert). Hence, this implementation is
     //! biased towards the fact that we __will__ have to compare every pair of
     //! elements in most cases, and it does not try to be lazy.
-    //!
-    //! @todo
-    //! This implementation is O(n^2). We could do it in O(n), but that would
-    //! require a more elaborate setup including storage with O(1) lookup
-    //! (which could be based on a compile-time hash). If we implement such
-    //! storage for associative sequences, we could use it to optimize this.
     template <typename ...T>
-    struct has_duplicates {
-        static constexpr bool value =
-            sizeof...(T) > 0 &&
-            !detail::fast_and<(detail::pack_count<T, T...>() == 1)...>::value
-        ;
-    };
+    struct has_duplicates
+        : has_duplicates_impl<
+            detail::fast_and<hana::Hashable<T>::value...>::value, T...
+        >
+    { };
 } BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_DETAIL_HAS_DUPLICATES_HPP
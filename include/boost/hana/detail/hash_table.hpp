@@ -11,6 +11,7 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_HASH_TABLE_HPP
 #define BOOST_HANA_DETAIL_HASH_TABLE_HPP
 
+#include <boost/hana/detail/fast_and.hpp>
 #include <boost/hana/equal.hpp>
 #include <boost/hana/ext/std/integer_sequence.hpp>
 #include <boost/hana/ext/std/integral_constant.hpp>
@@ -52,6 +53,32 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
     };
     // end find_indices
 
+    // find_bucket:
+    //  Returns the bucket of the `Map` associated to the given `Hash`, or
+    //  `no_bucket` if there is none. Unlike `find_indices`, this makes the
+    //  difference between a missing bucket and a bucket that is empty.
+    struct no_bucket { };
+
+    template <typename Hash, std::size_t ...i>
+    bucket<Hash, i...> find_bucket_impl(bucket<Hash, i...> const&);
+
+    template <typename Hash>
+    no_bucket find_bucket_impl(...);
+
+    template <typename Bucket>
+    struct bucket_indices;
+
+    template <typename Hash, std::size_t ...i>
+    struct bucket_indices<bucket<Hash, i...>> {
+        using type = std::index_sequence<i...>;
+    };
+
+    template <>
+    struct bucket_indices<no_bucket> {
+        using type = std::index_sequence<>;
+    };
+    // end find_bucket
+
     // find_index:
     //  Returns the actual index of a `Key` in the `Map`. The type of the key
     //  associated to any given index must be retrievable with the `KeyAtIndex`
@@ -91,6 +118,12 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
         using Indices = typename find_indices<Map, Key>::type;
         using type = typename find_index_impl<Indices, Key, KeyAtIndex>::type;
     };
+
+    // Looking up a key in an empty table does not require hashing it.
+    template <typename Key, template <std::size_t> class KeyAtIndex>
+    struct find_index<hash_table<>, Key, KeyAtIndex> {
+        using type = hana::optional<>;
+    };
     // end find_index
 
     // bucket_insert:
@@ -105,26 +138,112 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
         using type = bucket<Hash, i..., Index>;
     };
 
-    template <typename Map, typename Key, std::size_t Index, bool =
-        (find_indices<Map, Key>::type::size() > 0)
-    >
-    struct bucket_insert;
+    template <typename Map, typename Hash, std::size_t Index, bool HasBucket>
+    struct bucket_insert_impl;
 
-    template <typename ...Buckets, typename Key, std::size_t Index>
-    struct bucket_insert<hash_table<Buckets...>, Key, Index, true> {
+    template <typename ...Buckets, typename Hash, std::size_t Index>
+    struct bucket_insert_impl<hash_table<Buckets...>, Hash, Index, true> {
         // There is a bucket for that Hash; append the new index to it.
-        using Hash = typename decltype(hana::hash(std::declval<Key>()))::type;
         using type = hash_table<typename update_bucket<Buckets, Hash, Index>::type...>;
     };
 
-    template <typename ...Buckets, typename Key, std::size_t Index>
-    struct bucket_insert<hash_table<Buckets...>, Key, Index, false> {
+    template <typename ...Buckets, typename Hash, std::size_t Index>
+    struct bucket_insert_impl<hash_table<Buckets...>, Hash, Index, false> {
         // There is no bucket for that Hash; insert a new bucket.
-        using Hash = typename decltype(hana::hash(std::declval<Key>()))::type;
         using type = hash_table<Buckets..., bucket<Hash, Index>>;
     };
+
+    template <typename Map, typename Key, std::size_t Index,
+              typename Hash = typename decltype(hana::hash(std::declval<Key>()))::type>
+    struct bucket_insert
+        : bucket_insert_impl<Map, Hash, Index, !std::is_same<
+            decltype(detail::find_bucket_impl<Hash>(std::declval<Map>())),
+            no_bucket
+        >::value>
+    { };
     // end bucket_insert
 
+    // find_or_insert:
+    //  Looks up the `Key` in the `Map` and, if it is not found, inserts the
+    //  given `Index` into the bucket in which `Key` falls. This is equivalent
+    //  to `find_index` followed by `bucket_insert`, except the buckets of the
+    //  `Map` are searched only once. `MaybeIndex` is the result of the lookup,
+    //  and `type` is the new `Map`, which is the original `Map` whenever the
+    //  `Key` was already there.
+    template <typename Map, typename Hash, typename Bucket, std::size_t Index,
+              typename MaybeIndex>
+    struct find_or_insert_impl {
+        using type = Map;
+    };
+
+    template <typename Map, typename Hash, typename Bucket, std::size_t Index>
+    struct find_or_insert_impl<Map, Hash, Bucket, Index, hana::optional<>>
+        : bucket_insert_impl<Map, Hash, Index, !std::is_same<Bucket, no_bucket>::value>
+    { };
+
+    template <typename Map, typename Key, template <std::size_t> class KeyAtIndex,
+              std::size_t Index>
+    struct find_or_insert {
+        using Hash = typename decltype(hana::hash(std::declval<Key>()))::type;
+        using Bucket = decltype(detail::find_bucket_impl<Hash>(std::declval<Map>()));
+        using MaybeIndex = typename find_index_impl<
+            typename bucket_indices<Bucket>::type, Key, KeyAtIndex
+        >::type;
+        using type = typename find_or_insert_impl<
+            Map, Hash, Bucket, Index, MaybeIndex
+        >::type;
+    };
+    // end find_or_insert
+
+    // bucket_erase:
+    //  Removes the given `Index` from the bucket of the `Map` in which `Key`
+    //  falls, and decrements every index greater than `Index` in the other
+    //  buckets. This mirrors what `remove_at` does to the storage associated
+    //  to the `Map`, so no key needs to be hashed or compared again. A bucket
+    //  that becomes empty is kept in the `Map`; it matches no index, and it
+    //  is reused if a key with the same hash is inserted later on.
+    template <typename Hash, std::size_t Index, typename Kept, std::size_t ...i>
+    struct bucket_without;
+
+    template <typename Hash, std::size_t Index, std::size_t ...k>
+    struct bucket_without<Hash, Index, std::index_sequence<k...>> {
+        using type = bucket<Hash, k...>;
+    };
+
+    template <typename Hash, std::size_t Index, std::size_t ...k,
+              std::size_t i, std::size_t ...is>
+    struct bucket_without<Hash, Index, std::index_sequence<k...>, i, is...>
+        : bucket_without<Hash, Index, typename std::conditional<i == Index,
+            std::index_sequence<k...>,
+            std::index_sequence<k..., (i > Index ? i - 1 : i)>
+        >::type, is...>
+    { };
+
+    template <typename Bucket, typename Hash, std::size_t Index>
+    struct erase_from_bucket;
+
+    template <typename OtherHash, std::size_t ...i, typename Hash, std::size_t Index>
+    struct erase_from_bucket<bucket<OtherHash, i...>, Hash, Index> {
+        using type = bucket<OtherHash, (i > Index ? i - 1 : i)...>;
+    };
+
+    template <std::size_t ...i, typename Hash, std::size_t Index>
+    struct erase_from_bucket<bucket<Hash, i...>, Hash, Index>
+        : bucket_without<Hash, Index, std::index_sequence<>, i...>
+    { };
+
+    template <typename Map, typename Key, std::size_t Index>
+    struct bucket_erase;
+
+    template <typename ...Buckets, typename Key, std::size_t Index>
+    struct bucket_erase<hash_table<Buckets...>, Key, Index> {
+        using Hash = typename decltype(hana::hash(std::declval<Key>()))::type;
+        using type = hash_table<
+            typename erase_from_bucket<Buckets, Hash, Index>::type...
+        >;
+    };
+    // end bucket_erase
+
     // make_hash_table:
     //  Creates a `hash_table` type able of holding the given number of
     //  elements. The type of the key associated to any given index must
@@ -140,6 +259,60 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
             bucket<typename decltype(hana::hash(std::declval<KeyAtIndex<i>>()))::type, i>...
         >;
     };
+    // end make_hash_table
+
+    // make_colliding_hash_table:
+    //  Creates a `hash_table` type holding the given number of elements,
+    //  like `make_hash_table`. However, the keys are only required to be
+    //  distinct; their hashes may collide.
+    //
+    //  The common case where all the hashes are different is detected by
+    //  looking up each key in the table built by `make_hash_table`. When
+    //  two hashes collide, their buckets make that lookup ambiguous, and
+    //  we fall back to inserting the indices one by one, which handles
+    //  collisions properly but is quadratic.
+    template <typename HashTable, template <std::size_t> class KeyAtIndex, std::size_t ...i>
+    struct bucket_insert_all {
+        using type = HashTable;
+    };
+
+    template <typename HashTable, template <std::size_t> class KeyAtIndex,
+              std::size_t i, std::size_t ...is>
+    struct bucket_insert_all<HashTable, KeyAtIndex, i, is...>
+        : bucket_insert_all<
+            typename bucket_insert<HashTable, KeyAtIndex<i>, i>::type,
+            KeyAtIndex, is...
+        >
+    { };
+
+    template <bool NoCollisions, typename Candidate,
+              template <std::size_t> class KeyAtIndex, typename Indices>
+    struct make_colliding_hash_table_impl {
+        using type = Candidate;
+    };
+
+    template <typename Candidate, template <std::size_t> class KeyAtIndex, std::size_t ...i>
+    struct make_colliding_hash_table_impl<false, Candidate, KeyAtIndex, std::index_sequence<i...>>
+        : bucket_insert_all<hash_table<>, KeyAtIndex, i...>
+    { };
+
+    template <template <std::size_t> class KeyAtIndex, std::size_t N,
+              typename Indices = std::make_index_sequence<N>>
+    struct make_colliding_hash_table;
+
+    template <template <std::size_t> class KeyAtIndex, std::size_t N, std::size_t ...i>
+    struct make_colliding_hash_table<KeyAtIndex, N, std::index_sequence<i...>>
+        : make_colliding_hash_table_impl<
+            detail::fast_and<
+                (find_indices<
+                    typename make_hash_table<KeyAtIndex, N>::type, KeyAtIndex<i>
+                 >::type::size() == 1)...
+            >::value,
+            typename make_hash_table<KeyAtIndex, N>::type,
+            KeyAtIndex, std::index_sequence<i...>
+        >
+    { };
+    // end make_colliding_hash_table
 } BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_DETAIL_HASH_TABLE_HPP
@@ -11,7 +11,7 @@ Distributed under the Boost Software License, Version 1.0.
 #define BOOST_HANA_DETAIL_INDEX_IF_HPP
 
 #include <boost/hana/config.hpp>
-#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/decay.hpp>
 
 #include <cstddef>
 #include <utility>
@@ -36,34 +36,41 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
     template <typename T> struct make_pack<T&&> : make_pack<T> { };
 
 
+    template <bool ...b>
+    struct first_true {
+        static constexpr std::size_t compute() {
+            constexpr bool bs[] = {b..., false}; // avoid empty array
+            std::size_t i = 0;
+            while (i < sizeof...(b) && !bs[i])
+                ++i;
+            return i;
+        }
+
+        static constexpr std::size_t value = compute();
+    };
+
     //! @ingroup group-details
     //! Returns the index of the first element of the `pack<>` that satisfies
     //! the predicate, or the size of the pack if there is no such element.
     //!
+    //! The predicate is applied to all the elements in a single pack
+    //! expansion, and the first match is then found with a `constexpr`
+    //! loop. Hence, the instantiation depth does not depend on the size
+    //! of the pack, but the predicate is evaluated on every element, even
+    //! those following the first match.
+    //!
     //! @note
     //! The predicate must return an `IntegralConstant` that can be explicitly
     //! converted to `bool`.
-    template <typename Pred, typename Ts, typename = when<true>>
+    template <typename Pred, typename Ts>
     struct index_if;
 
-    template <typename Pred, typename T, typename ...Ts>
-    struct index_if<Pred, pack<T, Ts...>, when<static_cast<bool>(decltype(
-        std::declval<Pred>()(std::declval<T>())
-    )::value)>> {
-        static constexpr std::size_t value = 0;
-    };
-
-    template <typename Pred, typename T, typename ...Ts>
-    struct index_if<Pred, pack<T, Ts...>, when<!static_cast<bool>(decltype(
-        std::declval<Pred>()(std::declval<T>())
-    )::value)>> {
-        static constexpr std::size_t value = 1 + index_if<Pred, pack<Ts...>>::value;
-    };
-
-    template <typename Pred>
-    struct index_if<Pred, pack<>> {
-        static constexpr std::size_t value = 0;
-    };
+    template <typename Pred, typename ...Ts>
+    struct index_if<Pred, pack<Ts...>>
+        : first_true<static_cast<bool>(detail::decay<decltype(
+            std::declval<Pred>()(std::declval<Ts>())
+        )>::type::value)...>
+    { };
 } BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_DETAIL_INDEX_IF_HPP
@@ -103,4 +103,178 @@ Distributed under the Boost Software License, Version 1.0.
 //! This macro may not be called with less than 2 arguments.
 #define BOOST_HANA_PP_DROP_FRONT(e0, ...) __VA_ARGS__
 
+//! @ingroup group-details
+//! Expands to `f(data, x1) ... f(data, xn)`.
+//!
+//! Unlike the other macros of this file, this macro does not need one
+//! helper macro per number of arguments. Instead, it expands 16 elements
+//! per rescan, and it is rescanned enough times to process up to 496
+//! elements. `BOOST_HANA_PP_FOR_EACH(f, data)` expands to nothing, and
+//! the elements may be parenthesized, as in `(int, x)`.
+#define BOOST_HANA_PP_FOR_EACH(f, ...)                                      \
+    BOOST_HANA_PP_CALL(BOOST_HANA_PP_FOR_EACH_START,                        \
+        (f, __VA_ARGS__, BOOST_HANA_PP_PADDING))
+
+#define BOOST_HANA_PP_FOR_EACH_START(f, data,                               \
+        x1, x2, x3, x4, x5, x6, x7, x8,                                   \
+        x9, x10, x11, x12, x13, x14, x15, x16, peek, ...)                 \
+    BOOST_HANA_PP_IF_END(peek, BOOST_HANA_PP_EVAL_1, BOOST_HANA_PP_EVAL)( \
+        BOOST_HANA_PP_FOR_EACH_0(f, data,                                 \
+            x1, x2, x3, x4, x5, x6, x7, x8,                               \
+            x9, x10, x11, x12, x13, x14, x15, x16, peek, __VA_ARGS__))
+
+#define BOOST_HANA_PP_FOR_EACH_0(f, data,                                   \
+        x1, x2, x3, x4, x5, x6, x7, x8,                                     \
+        x9, x10, x11, x12, x13, x14, x15, x16, peek, ...)                   \
+    BOOST_HANA_PP_WHEN(x1, f)(data, x1)                                     \
+    BOOST_HANA_PP_WHEN(x2, f)(data, x2)                                     \
+    BOOST_HANA_PP_WHEN(x3, f)(data, x3)                                     \
+    BOOST_HANA_PP_WHEN(x4, f)(data, x4)                                     \
+    BOOST_HANA_PP_WHEN(x5, f)(data, x5)                                     \
+    BOOST_HANA_PP_WHEN(x6, f)(data, x6)                                     \
+    BOOST_HANA_PP_WHEN(x7, f)(data, x7)                                     \
+    BOOST_HANA_PP_WHEN(x8, f)(data, x8)                                     \
+    BOOST_HANA_PP_WHEN(x9, f)(data, x9)                                     \
+    BOOST_HANA_PP_WHEN(x10, f)(data, x10)                                   \
+    BOOST_HANA_PP_WHEN(x11, f)(data, x11)                                   \
+    BOOST_HANA_PP_WHEN(x12, f)(data, x12)                                   \
+    BOOST_HANA_PP_WHEN(x13, f)(data, x13)                                   \
+    BOOST_HANA_PP_WHEN(x14, f)(data, x14)                                   \
+    BOOST_HANA_PP_WHEN(x15, f)(data, x15)                                   \
+    BOOST_HANA_PP_WHEN(x16, f)(data, x16)                                   \
+    BOOST_HANA_PP_NEXT(peek, BOOST_HANA_PP_FOR_EACH_1)(f, data, peek, __VA_ARGS__)
+
+#define BOOST_HANA_PP_FOR_EACH_1(f, data,                                   \
+        x1, x2, x3, x4, x5, x6, x7, x8,                                     \
+        x9, x10, x11, x12, x13, x14, x15, x16, peek, ...)                   \
+    BOOST_HANA_PP_WHEN(x1, f)(data, x1)                                     \
+    BOOST_HANA_PP_WHEN(x2, f)(data, x2)                                     \
+    BOOST_HANA_PP_WHEN(x3, f)(data, x3)                                     \
+    BOOST_HANA_PP_WHEN(x4, f)(data, x4)                                     \
+    BOOST_HANA_PP_WHEN(x5, f)(data, x5)                                     \
+    BOOST_HANA_PP_WHEN(x6, f)(data, x6)                                     \
+    BOOST_HANA_PP_WHEN(x7, f)(data, x7)                                     \
+    BOOST_HANA_PP_WHEN(x8, f)(data, x8)                                     \
+    BOOST_HANA_PP_WHEN(x9, f)(data, x9)                                     \
+    BOOST_HANA_PP_WHEN(x10, f)(data, x10)                                   \
+    BOOST_HANA_PP_WHEN(x11, f)(data, x11)                                   \
+    BOOST_HANA_PP_WHEN(x12, f)(data, x12)                                   \
+    BOOST_HANA_PP_WHEN(x13, f)(data, x13)                                   \
+    BOOST_HANA_PP_WHEN(x14, f)(data, x14)                                   \
+    BOOST_HANA_PP_WHEN(x15, f)(data, x15)                                   \
+    BOOST_HANA_PP_WHEN(x16, f)(data, x16)                                   \
+    BOOST_HANA_PP_NEXT(peek, BOOST_HANA_PP_FOR_EACH_0)(f, data, peek, __VA_ARGS__)
+
+//! @ingroup group-details
+//! Expands to `f(data, x1), ..., f(data, xn)`.
+//!
+//! This is like `BOOST_HANA_PP_FOR_EACH`, except the results are separated
+//! by commas.
+#define BOOST_HANA_PP_TRANSFORM(f, ...)                                     \
+    BOOST_HANA_PP_CALL(BOOST_HANA_PP_TRANSFORM_START,                       \
+        (f, __VA_ARGS__, BOOST_HANA_PP_PADDING))
+
+#define BOOST_HANA_PP_TRANSFORM_START(f, data,                              \
+        x1, x2, x3, x4, x5, x6, x7, x8,                                   \
+        x9, x10, x11, x12, x13, x14, x15, x16, peek, ...)                 \
+    BOOST_HANA_PP_IF_END(peek, BOOST_HANA_PP_EVAL_1, BOOST_HANA_PP_EVAL)( \
+        BOOST_HANA_PP_TRANSFORM_0(f, data,                                \
+            x1, x2, x3, x4, x5, x6, x7, x8,                               \
+            x9, x10, x11, x12, x13, x14, x15, x16, peek, __VA_ARGS__))
+
+#define BOOST_HANA_PP_TRANSFORM_0(f, data,                                  \
+        x1, x2, x3, x4, x5, x6, x7, x8,                                     \
+        x9, x10, x11, x12, x13, x14, x15, x16, peek, ...)                   \
+    BOOST_HANA_PP_WHEN(x1, f)(data, x1)                                     \
+    BOOST_HANA_PP_WHEN_LIST(x2, f)(data, x2)                                \
+    BOOST_HANA_PP_WHEN_LIST(x3, f)(data, x3)                                \
+    BOOST_HANA_PP_WHEN_LIST(x4, f)(data, x4)                                \
+    BOOST_HANA_PP_WHEN_LIST(x5, f)(data, x5)                                \
+    BOOST_HANA_PP_WHEN_LIST(x6, f)(data, x6)                                \
+    BOOST_HANA_PP_WHEN_LIST(x7, f)(data, x7)                                \
+    BOOST_HANA_PP_WHEN_LIST(x8, f)(data, x8)                                \
+    BOOST_HANA_PP_WHEN_LIST(x9, f)(data, x9)                                \
+    BOOST_HANA_PP_WHEN_LIST(x10, f)(data, x10)                              \
+    BOOST_HANA_PP_WHEN_LIST(x11, f)(data, x11)                              \
+    BOOST_HANA_PP_WHEN_LIST(x12, f)(data, x12)                              \
+    BOOST_HANA_PP_WHEN_LIST(x13, f)(data, x13)                              \
+    BOOST_HANA_PP_WHEN_LIST(x14, f)(data, x14)                              \
+    BOOST_HANA_PP_WHEN_LIST(x15, f)(data, x15)                              \
+    BOOST_HANA_PP_WHEN_LIST(x16, f)(data, x16)                              \
+    BOOST_HANA_PP_NEXT_LIST(peek, BOOST_HANA_PP_TRANSFORM_1)(f, data, peek, __VA_ARGS__)
+
+#define BOOST_HANA_PP_TRANSFORM_1(f, data,                                  \
+        x1, x2, x3, x4, x5, x6, x7, x8,                                     \
+        x9, x10, x11, x12, x13, x14, x15, x16, peek, ...)                   \
+    BOOST_HANA_PP_WHEN(x1, f)(data, x1)                                     \
+    BOOST_HANA_PP_WHEN_LIST(x2, f)(data, x2)                                \
+    BOOST_HANA_PP_WHEN_LIST(x3, f)(data, x3)                                \
+    BOOST_HANA_PP_WHEN_LIST(x4, f)(data, x4)                                \
+    BOOST_HANA_PP_WHEN_LIST(x5, f)(data, x5)                                \
+    BOOST_HANA_PP_WHEN_LIST(x6, f)(data, x6)                                \
+    BOOST_HANA_PP_WHEN_LIST(x7, f)(data, x7)                                \
+    BOOST_HANA_PP_WHEN_LIST(x8, f)(data, x8)                                \
+    BOOST_HANA_PP_WHEN_LIST(x9, f)(data, x9)                                \
+    BOOST_HANA_PP_WHEN_LIST(x10, f)(data, x10)                              \
+    BOOST_HANA_PP_WHEN_LIST(x11, f)(data, x11)                              \
+    BOOST_HANA_PP_WHEN_LIST(x12, f)(data, x12)                              \
+    BOOST_HANA_PP_WHEN_LIST(x13, f)(data, x13)                              \
+    BOOST_HANA_PP_WHEN_LIST(x14, f)(data, x14)                              \
+    BOOST_HANA_PP_WHEN_LIST(x15, f)(data, x15)                              \
+    BOOST_HANA_PP_WHEN_LIST(x16, f)(data, x16)                              \
+    BOOST_HANA_PP_NEXT_LIST(peek, BOOST_HANA_PP_TRANSFORM_0)(f, data, peek, __VA_ARGS__)
+
+// Helpers for BOOST_HANA_PP_FOR_EACH and BOOST_HANA_PP_TRANSFORM.
+//
+// Each iteration of the loops above handles the next 16 elements, and then
+// expands to the name of the macro handling the following ones, followed by
+// BOOST_HANA_PP_OUT. This prevents that macro from being expanded until the
+// next rescan, and hence from being treated as a recursive call.
+// BOOST_HANA_PP_EVAL rescans its arguments enough times for 31 iterations,
+// i.e. 496 elements. Since every rescan goes over everything expanded so far,
+// BOOST_HANA_PP_EVAL is only used when there are more than 16 elements.
+//
+// The end of the elements is marked by `()()()`, and the elements are
+// padded with enough markers to fill the last iteration.
+// BOOST_HANA_PP_WHEN(x, f) expands to `f` unless `x` is that marker, in
+// which case it expands to BOOST_HANA_PP_END, which swallows the arguments
+// that would have been given to `f`. BOOST_HANA_PP_NEXT(peek, next) does
+// the same, except that `next` is not expanded until the next rescan.
+// BOOST_HANA_PP_IF_END(x, t, f) expands to `t` if `x` is the marker, and
+// to `f` otherwise.
+#define BOOST_HANA_PP_EVAL(...) BOOST_HANA_PP_EVAL_4(BOOST_HANA_PP_EVAL_4(__VA_ARGS__))
+#define BOOST_HANA_PP_EVAL_4(...) BOOST_HANA_PP_EVAL_3(BOOST_HANA_PP_EVAL_3(__VA_ARGS__))
+#define BOOST_HANA_PP_EVAL_3(...) BOOST_HANA_PP_EVAL_2(BOOST_HANA_PP_EVAL_2(__VA_ARGS__))
+#define BOOST_HANA_PP_EVAL_2(...) BOOST_HANA_PP_EVAL_1(BOOST_HANA_PP_EVAL_1(__VA_ARGS__))
+#define BOOST_HANA_PP_EVAL_1(...) __VA_ARGS__
+
+#define BOOST_HANA_PP_CALL(macro, args) macro args
+#define BOOST_HANA_PP_PADDING                                               \
+    ()()(), ()()(), ()()(), ()()(), ()()(), ()()(), ()()(), ()()(), ()()(), \
+    ()()(), ()()(), ()()(), ()()(), ()()(), ()()(), ()()(), ()()(), 0
+
+#define BOOST_HANA_PP_OUT
+#define BOOST_HANA_PP_COMMA ,
+#define BOOST_HANA_PP_END(...)
+#define BOOST_HANA_PP_GET_END_2() 0, BOOST_HANA_PP_END
+#define BOOST_HANA_PP_GET_END_1(...) BOOST_HANA_PP_GET_END_2
+#define BOOST_HANA_PP_GET_END(...) BOOST_HANA_PP_GET_END_1
+#define BOOST_HANA_PP_SELECT(test, f, ...) f
+#define BOOST_HANA_PP_SELECT_3(test, t, f, ...) f
+
+#define BOOST_HANA_PP_IF_END_1(test, t, f) BOOST_HANA_PP_SELECT_3(test, t, f, 0)
+#define BOOST_HANA_PP_IF_END(x, t, f) BOOST_HANA_PP_IF_END_1(BOOST_HANA_PP_GET_END x, t, f)
+
+#define BOOST_HANA_PP_WHEN_1(test, f) BOOST_HANA_PP_SELECT(test, f, 0)
+#define BOOST_HANA_PP_WHEN(x, f) BOOST_HANA_PP_WHEN_1(BOOST_HANA_PP_GET_END x, f)
+#define BOOST_HANA_PP_WHEN_LIST_1(test, f) BOOST_HANA_PP_SELECT(test, BOOST_HANA_PP_COMMA f, 0)
+#define BOOST_HANA_PP_WHEN_LIST(x, f) BOOST_HANA_PP_WHEN_LIST_1(BOOST_HANA_PP_GET_END x, f)
+
+#define BOOST_HANA_PP_NEXT_1(test, next) BOOST_HANA_PP_SELECT(test, next, 0) BOOST_HANA_PP_OUT
+#define BOOST_HANA_PP_NEXT(peek, next) BOOST_HANA_PP_NEXT_1(BOOST_HANA_PP_GET_END peek, next)
+#define BOOST_HANA_PP_NEXT_LIST_1(test, next) \
+    BOOST_HANA_PP_SELECT(test, BOOST_HANA_PP_COMMA next, 0) BOOST_HANA_PP_OUT
+#define BOOST_HANA_PP_NEXT_LIST(peek, next) \
+    BOOST_HANA_PP_NEXT_LIST_1(BOOST_HANA_PP_GET_END peek, next)
+
 #endif // !BOOST_HANA_DETAIL_PREPROCESSOR_HPP
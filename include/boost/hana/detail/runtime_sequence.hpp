@@ -0,0 +1,33 @@
+/*!
+@file
+Defines `boost::hana::detail::runtime_sequence`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_RUNTIME_SEQUENCE_HPP
+#define BOOST_HANA_DETAIL_RUNTIME_SEQUENCE_HPP
+
+#include <boost/hana/config.hpp>
+
+#include <type_traits>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+    //! @ingroup group-detail
+    //! Whether the tag `S` is that of a homogeneous sequence whose length
+    //! is only known at runtime, like `std::vector`.
+    //!
+    //! Such sequences can't model `Foldable` or `Searchable`, since most
+    //! of the algorithms of these concepts need a compile-time length.
+    //! However, they can still provide the algorithms which don't, namely
+    //! `fold_left`, `fold_right`, `for_each`, `any_of`, `all_of`, `none_of`
+    //! and `contains`. These algorithms accept such sequences even though
+    //! they are neither `Foldable` nor `Searchable`.
+    template <typename S>
+    struct runtime_sequence : std::false_type { };
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_RUNTIME_SEQUENCE_HPP
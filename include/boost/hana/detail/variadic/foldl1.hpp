@@ -15,6 +15,45 @@ Distributed under the Boost Software License, Version 1.0.
 
 
 BOOST_HANA_NAMESPACE_BEGIN namespace detail { namespace variadic {
+#if defined(BOOST_HANA_CONFIG_HAS_FOLD_EXPRESSIONS)
+    // With fold expressions, each step of the fold is an application of
+    // `operator|` to an accumulator holding the current state, so folding
+    // any number of elements requires a constant template depth.
+    template <typename F, typename State>
+    struct foldl1_acc {
+        F& f;
+        State state;
+
+        constexpr State result() &&
+        { return static_cast<State&&>(state); }
+    };
+
+    template <typename F, typename State, typename X>
+    constexpr auto operator|(foldl1_acc<F, State>&& acc, X&& x) {
+        using Result = decltype(acc.f(static_cast<State&&>(acc.state),
+                                      static_cast<X&&>(x)));
+        return foldl1_acc<F, Result>{acc.f, acc.f(static_cast<State&&>(acc.state),
+                                                  static_cast<X&&>(x))};
+    }
+
+    struct foldl1_t {
+        template <typename F, typename X1>
+        constexpr X1 operator()(F&&, X1&& x1) const
+        { return static_cast<X1&&>(x1); }
+
+        template <typename F, typename X1, typename X2>
+        constexpr decltype(auto) operator()(F&& f, X1&& x1, X2&& x2) const {
+            return static_cast<F&&>(f)(static_cast<X1&&>(x1),
+                                       static_cast<X2&&>(x2));
+        }
+
+        template <typename F, typename X1, typename ...Xn>
+        constexpr decltype(auto) operator()(F&& f, X1&& x1, Xn&& ...xn) const {
+            return (foldl1_acc<F, X1&&>{f, static_cast<X1&&>(x1)} | ... |
+                    static_cast<Xn&&>(xn)).result();
+        }
+    };
+#else
     template <unsigned int n, typename = when<true>>
     struct foldl1_impl;
 
@@ -204,6 +243,7 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail { namespace variadic {
             );
         }
     };
+#endif
 
     constexpr foldl1_t foldl1{};
     constexpr auto foldl = foldl1;
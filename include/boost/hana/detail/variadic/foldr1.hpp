@@ -15,6 +15,74 @@ Distributed under the Boost Software License, Version 1.0.
 
 
 BOOST_HANA_NAMESPACE_BEGIN namespace detail { namespace variadic {
+#if defined(BOOST_HANA_CONFIG_HAS_FOLD_EXPRESSIONS)
+    // See foldl1.hpp. Folding from the right starts with the last element,
+    // which `foldr1` can't name directly; it is picked up by `operator|`
+    // on a `foldr1_seed`, which has no state yet.
+    template <typename F, typename State>
+    struct foldr1_acc {
+        F& f;
+        State state;
+
+        constexpr State result() &&
+        { return static_cast<State&&>(state); }
+    };
+
+    template <typename F>
+    struct foldr1_seed {
+        F& f;
+    };
+
+    template <typename X, typename F, typename State>
+    constexpr auto operator|(X&& x, foldr1_acc<F, State>&& acc) {
+        using Result = decltype(acc.f(static_cast<X&&>(x),
+                                      static_cast<State&&>(acc.state)));
+        return foldr1_acc<F, Result>{acc.f, acc.f(static_cast<X&&>(x),
+                                                  static_cast<State&&>(acc.state))};
+    }
+
+    template <typename X, typename F>
+    constexpr foldr1_acc<F, X&&> operator|(X&& x, foldr1_seed<F>&& seed)
+    { return {seed.f, static_cast<X&&>(x)}; }
+
+    struct foldr1_t {
+        template <typename F, typename X1>
+        constexpr X1 operator()(F&&, X1&& x1) const
+        { return static_cast<X1&&>(x1); }
+
+        template <typename F, typename X1, typename X2>
+        constexpr decltype(auto) operator()(F&& f, X1&& x1, X2&& x2) const {
+            return static_cast<F&&>(f)(static_cast<X1&&>(x1),
+                                       static_cast<X2&&>(x2));
+        }
+
+        template <typename F, typename X1, typename ...Xn>
+        constexpr decltype(auto) operator()(F&& f, X1&& x1, Xn&& ...xn) const {
+            return (static_cast<X1&&>(x1) |
+                    (static_cast<Xn&&>(xn) | ... | foldr1_seed<F>{f})).result();
+        }
+    };
+
+    constexpr foldr1_t foldr1{};
+
+    struct foldr_t {
+        template <typename F, typename State>
+        constexpr State operator()(F&&, State&& state) const
+        { return static_cast<State&&>(state); }
+
+        template <typename F, typename State, typename X1>
+        constexpr decltype(auto) operator()(F&& f, State&& state, X1&& x1) const {
+            return static_cast<F&&>(f)(static_cast<X1&&>(x1),
+                                       static_cast<State&&>(state));
+        }
+
+        template <typename F, typename State, typename ...Xn>
+        constexpr decltype(auto) operator()(F&& f, State&& state, Xn&& ...xn) const {
+            return (static_cast<Xn&&>(xn) | ... |
+                    foldr1_acc<F, State&&>{f, static_cast<State&&>(state)}).result();
+        }
+    };
+#else
     template <unsigned int n, typename = when<true>>
     struct foldr1_impl;
 
@@ -201,6 +269,7 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail { namespace variadic {
             );
         }
     };
+#endif
 
     constexpr foldr_t foldr{};
 }} BOOST_HANA_NAMESPACE_END
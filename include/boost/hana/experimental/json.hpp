@@ -0,0 +1,606 @@
+/*
+@file
+Defines `boost::hana::experimental::to_json` and
+`boost::hana::experimental::from_json`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_JSON_HPP
+#define BOOST_HANA_EXPERIMENTAL_JSON_HPP
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/concept/sequence.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/default.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/experimental/string_lookup.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/string.hpp>
+
+#include <algorithm>
+#include <clocale>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    //! @cond
+    template <typename T, typename = void>
+    struct json_impl : json_impl<T, hana::when<true>> { };
+
+    template <typename T, bool condition>
+    struct json_impl<T, hana::when<condition>> : hana::default_ {
+        template <typename ...Args>
+        static constexpr auto write(Args&& ...) = delete;
+
+        template <typename ...Args>
+        static constexpr auto parse(Args&& ...) = delete;
+    };
+    //! @endcond
+
+    //! @ingroup group-experimental
+    //! Writes the JSON representation of an object to an output iterator.
+    //!
+    //! `to_json(out, x)` writes `x` to the output iterator `out`, and returns
+    //! the iterator past the last character written. The JSON is compact, in
+    //! the sense that no whitespace is written. This is defined for
+    //! - `bool`, arithmetic types other than characters, and `std::string`
+    //! - `Struct`s, which are written as JSON objects whose keys are the
+    //!   names of their members
+    //! - `Sequence`s, which are written as JSON arrays
+    //!
+    //! and it can be extended to other types by specializing `json_impl`
+    //! with static `write` and `parse` functions. Nothing is allocated; in
+    //! particular, the keys of a `Struct` and the punctuation around them
+    //! are copied from character arrays computed at compile-time, and the
+    //! members are written directly to `out`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/json.cpp
+    template <typename OutputIterator, typename T>
+    OutputIterator to_json(OutputIterator out, T const& x) {
+        return json_impl<T>::write(out, x);
+    }
+
+    //! @ingroup group-experimental
+    //! Reads an object from its JSON representation.
+    //!
+    //! `from_json(first, last, x)` parses the JSON value at the beginning of
+    //! the characters in `[first, last)` into `x`, and returns a pointer past
+    //! the last character of that value. If the value can't be parsed into
+    //! `x`, a null pointer is returned instead, and `x` may be left partially
+    //! modified. Whitespace is skipped before the value, but not after it.
+    //!
+    //! This is defined for the same types as `to_json`. For a `Struct`, the
+    //! key of each member is looked up with a `string_lookup` computed at
+    //! compile-time, so the cost of finding a member does not depend on the
+    //! number of members. Members that do not appear in the JSON are left
+    //! untouched, and keys that are not the name of a member are skipped,
+    //! along with their value. Keys are compared with the names of the
+    //! members without decoding their escape sequences, if any.
+    template <typename T>
+    char const* from_json(char const* first, char const* last, T& x) {
+        return json_impl<T>::parse(first, last, x);
+    }
+
+    namespace detail {
+        template <typename OutputIterator, std::size_t n>
+        OutputIterator write_chars(OutputIterator out, char const (&chars)[n]) {
+            return std::copy(chars, chars + n, out);
+        }
+
+        inline char const* skip_whitespace(char const* first, char const* last) {
+            while (first != last && (*first == ' ' || *first == '\n' ||
+                                     *first == '\r' || *first == '\t'))
+                ++first;
+            return first;
+        }
+
+        // Skips whitespace, and then the given character. Returns a null
+        // pointer if that character is not found.
+        inline char const* expect(char const* first, char const* last, char c) {
+            first = detail::skip_whitespace(first, last);
+            return first != last && *first == c ? first + 1 : nullptr;
+        }
+
+        inline char const* expect_word(char const* first, char const* last,
+                                       char const* word, std::size_t n)
+        {
+            if (static_cast<std::size_t>(last - first) < n ||
+                !std::equal(word, word + n, first))
+                return nullptr;
+            return first + n;
+        }
+
+        // Skips a string, without the opening quote. Returns a pointer past
+        // the closing quote.
+        inline char const* skip_string(char const* first, char const* last) {
+            for (; first != last; ++first) {
+                if (*first == '"')
+                    return first + 1;
+                if (*first == '\\' && ++first == last)
+                    return nullptr;
+            }
+            return nullptr;
+        }
+
+        // Skips any JSON value. This is used for the values of the keys
+        // of an object that are not the name of a member.
+        inline char const* skip_value(char const* first, char const* last) {
+            first = detail::skip_whitespace(first, last);
+            if (first == last)
+                return nullptr;
+            if (*first == '"')
+                return detail::skip_string(first + 1, last);
+            if (*first != '{' && *first != '[') {
+                while (first != last && *first != ',' && *first != '}' &&
+                       *first != ']' && *first != ' ' && *first != '\n' &&
+                       *first != '\r' && *first != '\t')
+                    ++first;
+                return first;
+            }
+
+            std::size_t depth = 0;
+            for (; first != last; ++first) {
+                if (*first == '"') {
+                    if (!(first = detail::skip_string(first + 1, last)))
+                        return nullptr;
+                    --first;
+                }
+                else if (*first == '{' || *first == '[')
+                    ++depth;
+                else if ((*first == '}' || *first == ']') && --depth == 0)
+                    return first + 1;
+            }
+            return nullptr;
+        }
+
+        // Parses the hexadecimal digits of a `\uXXXX` escape sequence.
+        inline char const* parse_hex4(char const* first, char const* last,
+                                      unsigned long& code)
+        {
+            if (last - first < 4)
+                return nullptr;
+            code = 0;
+            for (char const* end = first + 4; first != end; ++first) {
+                char c = *first;
+                code *= 16;
+                if (c >= '0' && c <= '9')      code += static_cast<unsigned long>(c - '0');
+                else if (c >= 'a' && c <= 'f') code += static_cast<unsigned long>(c - 'a' + 10);
+                else if (c >= 'A' && c <= 'F') code += static_cast<unsigned long>(c - 'A' + 10);
+                else return nullptr;
+            }
+            return first;
+        }
+
+        inline void append_utf8(std::string& s, unsigned long code) {
+            if (code < 0x80) {
+                s += static_cast<char>(code);
+            } else if (code < 0x800) {
+                s += static_cast<char>(0xC0 | (code >> 6));
+                s += static_cast<char>(0x80 | (code & 0x3F));
+            } else if (code < 0x10000) {
+                s += static_cast<char>(0xE0 | (code >> 12));
+                s += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                s += static_cast<char>(0x80 | (code & 0x3F));
+            } else {
+                s += static_cast<char>(0xF0 | (code >> 18));
+                s += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+                s += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                s += static_cast<char>(0x80 | (code & 0x3F));
+            }
+        }
+
+        // The characters written before the value of a member of a Struct,
+        // which are `{"name":` for the first member and `,"name":` for the
+        // other ones.
+        template <bool first, typename Name>
+        struct member_prefix;
+
+        template <bool first, char ...s>
+        struct member_prefix<first, hana::string<s...>> {
+            static constexpr char value[] = {first ? '{' : ',', '"', s..., '"', ':'};
+        };
+
+        template <bool first, char ...s>
+        constexpr char member_prefix<first, hana::string<s...>>::value[];
+
+        template <typename T>
+        struct member_writer {
+            T const& object;
+
+            template <std::size_t i, typename OutputIterator>
+            OutputIterator write(OutputIterator out) const {
+                auto accessors = hana::accessors<T>();
+                auto const& accessor = hana::at_c<i>(accessors);
+                using Name = typename hana::detail::decay<
+                    decltype(hana::first(accessor))
+                >::type;
+                using Member = typename hana::detail::decay<
+                    decltype(hana::second(accessor)(object))
+                >::type;
+                out = detail::write_chars(out, member_prefix<i == 0, Name>::value);
+                return json_impl<Member>::write(out, hana::second(accessor)(object));
+            }
+        };
+
+        template <typename T>
+        struct member_parser {
+            T& object;
+            char const*& first;
+            char const* last;
+
+            template <typename Name>
+            char const* operator()(Name const& name) const {
+                auto& member = hana::at_key(object, name);
+                return first = experimental::from_json(first, last, member);
+            }
+        };
+
+        struct skip_member {
+            char const*& first;
+            char const* last;
+
+            char const* operator()() const
+            { return first = detail::skip_value(first, last); }
+        };
+    }
+
+    //! @cond
+    template <>
+    struct json_impl<bool> {
+        template <typename OutputIterator>
+        static OutputIterator write(OutputIterator out, bool x) {
+            return x ? detail::write_chars(out, {'t', 'r', 'u', 'e'})
+                     : detail::write_chars(out, {'f', 'a', 'l', 's', 'e'});
+        }
+
+        static char const* parse(char const* first, char const* last, bool& x) {
+            first = detail::skip_whitespace(first, last);
+            if (char const* end = detail::expect_word(first, last, "true", 4)) {
+                x = true;
+                return end;
+            }
+            if (char const* end = detail::expect_word(first, last, "false", 5)) {
+                x = false;
+                return end;
+            }
+            return nullptr;
+        }
+    };
+
+    template <typename T>
+    struct json_impl<T, hana::when<
+        std::is_integral<T>::value &&
+        !std::is_same<T, bool>::value &&
+        !std::is_same<T, char>::value
+    >> {
+        using Unsigned = typename std::make_unsigned<T>::type;
+
+        template <typename OutputIterator>
+        static OutputIterator write(OutputIterator out, T x) {
+            char buffer[std::numeric_limits<Unsigned>::digits10 + 2];
+            char* end = buffer + sizeof(buffer);
+            char* begin = end;
+            bool negative = x < 0;
+            Unsigned n = negative ? static_cast<Unsigned>(Unsigned{0} - static_cast<Unsigned>(x))
+                                  : static_cast<Unsigned>(x);
+            do {
+                *--begin = static_cast<char>('0' + n % 10);
+                n /= 10;
+            } while (n != 0);
+            if (negative)
+                *out++ = '-';
+            return std::copy(begin, end, out);
+        }
+
+        static char const* parse(char const* first, char const* last, T& x) {
+            first = detail::skip_whitespace(first, last);
+            bool negative = first != last && *first == '-';
+            if (negative && !std::is_signed<T>::value)
+                return nullptr;
+            if (negative)
+                ++first;
+            if (first == last || *first < '0' || *first > '9')
+                return nullptr;
+
+            Unsigned limit = negative
+                ? static_cast<Unsigned>(Unsigned{0} - static_cast<Unsigned>(std::numeric_limits<T>::min()))
+                : static_cast<Unsigned>(std::numeric_limits<T>::max());
+            Unsigned n = 0;
+            for (; first != last && *first >= '0' && *first <= '9'; ++first) {
+                Unsigned digit = static_cast<Unsigned>(*first - '0');
+                if (n > (limit - digit) / 10)
+                    return nullptr;
+                n = static_cast<Unsigned>(n * 10 + digit);
+            }
+            x = negative ? static_cast<T>(Unsigned{0} - n) : static_cast<T>(n);
+            return first;
+        }
+    };
+
+    template <typename T>
+    struct json_impl<T, hana::when<std::is_floating_point<T>::value>> {
+        // Non-finite numbers can't be represented in JSON, so they are
+        // written as `null`, which is parsed back as a NaN.
+        template <typename OutputIterator>
+        static OutputIterator write(OutputIterator out, T x) {
+            if (!std::isfinite(x))
+                return detail::write_chars(out, {'n', 'u', 'l', 'l'});
+            char buffer[48];
+            int n = std::snprintf(buffer, sizeof(buffer), "%.*Lg",
+                                  std::numeric_limits<T>::max_digits10,
+                                  static_cast<long double>(x));
+
+            // snprintf uses the decimal point of the current C locale, which
+            // is replaced by the '.' required by JSON.
+            char const* point = std::localeconv()->decimal_point;
+            char const* point_end = point + std::strlen(point);
+            char* p = std::search(buffer, buffer + n, point, point_end);
+            if (p == buffer + n)
+                return std::copy(buffer, buffer + n, out);
+            out = std::copy(buffer, p, out);
+            *out++ = '.';
+            return std::copy(p + (point_end - point), buffer + n, out);
+        }
+
+        static char const* parse(char const* first, char const* last, T& x) {
+            first = detail::skip_whitespace(first, last);
+            if (char const* end = detail::expect_word(first, last, "null", 4)) {
+                x = std::numeric_limits<T>::quiet_NaN();
+                return end;
+            }
+
+            std::size_t n = 0;
+            for (; first + n != last; ++n) {
+                char c = first[n];
+                if (!((c >= '0' && c <= '9') || c == '-' || c == '+' ||
+                      c == '.' || c == 'e' || c == 'E'))
+                    break;
+            }
+            if (n == 0)
+                return nullptr;
+
+            // strtold requires a null-terminated string, so the number is
+            // copied to a buffer first. It also uses the decimal point of
+            // the current C locale, which replaces the '.' of the number.
+            // Most numbers fit in a buffer on the stack, and longer ones are
+            // copied to a string.
+            char const* point = std::localeconv()->decimal_point;
+            std::size_t point_size = std::strlen(point);
+            char small[64];
+            std::string large;
+            char* buffer = small;
+            if (n + point_size >= sizeof(small)) {
+                large.resize(n + point_size);
+                buffer = &large[0];
+            }
+            char const* dot = std::find(first, first + n, '.');
+            char* buffer_end = std::copy(first, dot, buffer);
+            if (dot != first + n) {
+                buffer_end = std::copy(point, point + point_size, buffer_end);
+                buffer_end = std::copy(dot + 1, first + n, buffer_end);
+            }
+            *buffer_end = '\0';
+            char* end;
+            long double value = std::strtold(buffer, &end);
+            if (end != buffer_end)
+                return nullptr;
+            x = static_cast<T>(value);
+            return first + n;
+        }
+    };
+
+    template <>
+    struct json_impl<std::string> {
+        template <typename OutputIterator>
+        static OutputIterator write(OutputIterator out, std::string const& x) {
+            static constexpr char hex[] = "0123456789abcdef";
+            *out++ = '"';
+            char const* first = x.data();
+            char const* last = first + x.size();
+            while (first != last) {
+                // Copy the longest run of characters that need no escaping
+                // at once.
+                char const* run = first;
+                while (run != last && *run != '"' && *run != '\\' &&
+                       static_cast<unsigned char>(*run) >= 0x20)
+                    ++run;
+                out = std::copy(first, run, out);
+                if (run == last)
+                    break;
+
+                unsigned char c = static_cast<unsigned char>(*run);
+                *out++ = '\\';
+                switch (c) {
+                    case '"':  *out++ = '"'; break;
+                    case '\\': *out++ = '\\'; break;
+                    case '\b': *out++ = 'b'; break;
+                    case '\f': *out++ = 'f'; break;
+                    case '\n': *out++ = 'n'; break;
+                    case '\r': *out++ = 'r'; break;
+                    case '\t': *out++ = 't'; break;
+                    default:
+                        out = detail::write_chars(out,
+                            {'u', '0', '0', hex[c >> 4], hex[c & 0xF]});
+                }
+                first = run + 1;
+            }
+            *out++ = '"';
+            return out;
+        }
+
+        static char const* parse(char const* first, char const* last, std::string& x) {
+            if (!(first = detail::expect(first, last, '"')))
+                return nullptr;
+
+            x.clear();
+            while (first != last) {
+                char const* run = first;
+                while (run != last && *run != '"' && *run != '\\')
+                    ++run;
+                x.append(first, run);
+                if (run == last)
+                    return nullptr;
+                if (*run == '"')
+                    return run + 1;
+
+                if (++run == last)
+                    return nullptr;
+                first = run + 1;
+                switch (*run) {
+                    case '"':  x += '"'; break;
+                    case '\\': x += '\\'; break;
+                    case '/':  x += '/'; break;
+                    case 'b':  x += '\b'; break;
+                    case 'f':  x += '\f'; break;
+                    case 'n':  x += '\n'; break;
+                    case 'r':  x += '\r'; break;
+                    case 't':  x += '\t'; break;
+                    case 'u': {
+                        unsigned long code;
+                        if (!(first = detail::parse_hex4(first, last, code)))
+                            return nullptr;
+                        if (code >= 0xD800 && code <= 0xDBFF) {
+                            unsigned long low;
+                            if (last - first < 2 || first[0] != '\\' || first[1] != 'u' ||
+                                !(first = detail::parse_hex4(first + 2, last, low)) ||
+                                low < 0xDC00 || low > 0xDFFF)
+                                return nullptr;
+                            code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                        }
+                        detail::append_utf8(x, code);
+                        break;
+                    }
+                    default:
+                        return nullptr;
+                }
+            }
+            return nullptr;
+        }
+    };
+
+    template <typename T>
+    struct json_impl<T, hana::when<hana::Struct<T>::value>> {
+        template <typename OutputIterator, std::size_t ...i>
+        static OutputIterator
+        write_members(OutputIterator out, T const& x, std::index_sequence<i...>) {
+            detail::member_writer<T> writer{x};
+            int expand[] = {0, ((void)(out = writer.template write<i>(out)), 0)...};
+            (void)expand; (void)writer;
+            return out;
+        }
+
+        template <typename OutputIterator>
+        static OutputIterator write(OutputIterator out, T const& x) {
+            constexpr std::size_t N = decltype(hana::length(hana::accessors<T>()))::value;
+            if (N == 0)
+                *out++ = '{';
+            out = write_members(out, x, std::make_index_sequence<N>{});
+            *out++ = '}';
+            return out;
+        }
+
+        static char const* parse(char const* first, char const* last, T& x) {
+            using Lookup = decltype(experimental::make_string_lookup(hana::keys(x)));
+
+            if (!(first = detail::expect(first, last, '{')))
+                return nullptr;
+            first = detail::skip_whitespace(first, last);
+            if (first != last && *first == '}')
+                return first + 1;
+
+            while (true) {
+                if (!(first = detail::expect(first, last, '"')))
+                    return nullptr;
+                char const* key = first;
+                if (!(first = detail::skip_string(first, last)))
+                    return nullptr;
+                std::size_t length = static_cast<std::size_t>(first - key - 1);
+                if (!(first = detail::expect(first, last, ':')))
+                    return nullptr;
+
+                if (!Lookup::visit(key, length,
+                        detail::member_parser<T>{x, first, last},
+                        detail::skip_member{first, last}))
+                    return nullptr;
+
+                first = detail::skip_whitespace(first, last);
+                if (first == last)
+                    return nullptr;
+                if (*first == '}')
+                    return first + 1;
+                if (*first++ != ',')
+                    return nullptr;
+            }
+        }
+    };
+
+    template <typename T>
+    struct json_impl<T, hana::when<hana::Sequence<T>::value>> {
+        template <typename OutputIterator, std::size_t ...i>
+        static OutputIterator
+        write_elements(OutputIterator out, T const& xs, std::index_sequence<0, i...>) {
+            out = experimental::to_json(out, hana::at_c<0>(xs));
+            int expand[] = {0, ((void)(*out++ = ','),
+                                (void)(out = experimental::to_json(out, hana::at_c<i>(xs))),
+                                0)...};
+            (void)expand;
+            return out;
+        }
+
+        template <typename OutputIterator>
+        static OutputIterator write_elements(OutputIterator out, T const&, std::index_sequence<>)
+        { return out; }
+
+        template <typename OutputIterator>
+        static OutputIterator write(OutputIterator out, T const& xs) {
+            constexpr std::size_t N = decltype(hana::length(xs))::value;
+            *out++ = '[';
+            out = write_elements(out, xs, std::make_index_sequence<N>{});
+            *out++ = ']';
+            return out;
+        }
+
+        template <std::size_t ...i>
+        static char const*
+        parse_elements(char const* first, char const* last, T& xs, std::index_sequence<i...>) {
+            int expand[] = {0, ((void)(first = first && (i == 0 || (first = detail::expect(first, last, ',')))
+                                    ? experimental::from_json(first, last, hana::at_c<i>(xs))
+                                    : nullptr), 0)...};
+            (void)expand; (void)last;
+            return first;
+        }
+
+        static char const* parse(char const* first, char const* last, T& xs) {
+            constexpr std::size_t N = decltype(hana::length(xs))::value;
+            if (!(first = detail::expect(first, last, '[')))
+                return nullptr;
+            if (!(first = parse_elements(first, last, xs, std::make_index_sequence<N>{})))
+                return nullptr;
+            return detail::expect(first, last, ']');
+        }
+    };
+    //! @endcond
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_JSON_HPP
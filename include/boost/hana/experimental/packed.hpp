@@ -0,0 +1,305 @@
+/*
+@file
+Defines `boost::hana::experimental::packed_layout`,
+`boost::hana::experimental::to_packed` and
+`boost::hana::experimental::from_packed`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_PACKED_HPP
+#define BOOST_HANA_EXPERIMENTAL_PACKED_HPP
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/sort.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    namespace detail {
+        template <typename S>
+        using packed_accessors = decltype(hana::accessors<S>());
+
+        template <typename S, std::size_t i>
+        using packed_member_ref = decltype(
+            hana::second(hana::at_c<i>(std::declval<packed_accessors<S>>()))(
+                std::declval<S&>()
+            )
+        );
+
+        // Not hana::detail::decay, since members of array type must be
+        // copied as arrays.
+        template <typename S, std::size_t i>
+        using packed_member = typename std::remove_cv<
+            typename std::remove_reference<packed_member_ref<S, i>>::type
+        >::type;
+
+        template <typename S>
+        struct by_decreasing_alignment {
+            template <typename I, typename J>
+            constexpr auto operator()(I const&, J const&) const {
+                return hana::bool_c<(alignof(packed_member<S, I::value>) >
+                                     alignof(packed_member<S, J::value>))>;
+            }
+        };
+
+        template <typename Indices>
+        struct as_index_sequence;
+
+        template <typename ...I>
+        struct as_index_sequence<hana::tuple<I...>> {
+            using type = std::index_sequence<I::value...>;
+        };
+
+        template <std::size_t N>
+        struct packed_layout_data {
+            // The declaration index of the member at each position of the
+            // packed representation.
+            hana::detail::array<std::size_t, N> order;
+
+            // The offset of each member in the packed representation,
+            // indexed by declaration index.
+            hana::detail::array<std::size_t, N> offsets;
+
+            // For each position starting a run of members that are adjacent
+            // both in the declaration and in the packed representation, the
+            // number of members in that run. This is 0 for the positions
+            // that do not start a run.
+            hana::detail::array<std::size_t, N> runs;
+
+            std::size_t size;
+        };
+    }
+
+    //! @ingroup group-experimental
+    //! Compile-time description of the packed binary representation of
+    //! a `Struct`.
+    //!
+    //! The packed representation of a `Struct` `S` is made of the object
+    //! representations of its members, without any padding in between.
+    //! To achieve that while keeping every member at an offset that is a
+    //! multiple of its alignment, the members are laid out in order of
+    //! decreasing alignment, which is computed at compile-time with
+    //! `hana::sort`. Since the sort is stable, members with the same
+    //! alignment keep their declaration order. Since the size of a type is
+    //! always a multiple of its alignment, this gives a representation
+    //! whose size is the sum of the sizes of the members, and in which all
+    //! the members are suitably aligned provided the whole buffer is aligned
+    //! for the first one.
+    //!
+    //! All the members must be trivially copyable, and the accessors of `S`
+    //! must return references to its members.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/packed.cpp
+    template <typename S>
+    struct packed_layout {
+        static_assert(hana::Struct<S>::value,
+        "hana::experimental::packed_layout<S> requires 'S' to be a Struct");
+
+    private:
+        static constexpr std::size_t N =
+            decltype(hana::length(std::declval<detail::packed_accessors<S>>()))::value;
+
+        template <std::size_t ...i>
+        static constexpr bool all_references(std::index_sequence<i...>) {
+            return hana::detail::fast_and<
+                std::is_lvalue_reference<detail::packed_member_ref<S, i>>::value...
+            >::value;
+        }
+
+        template <std::size_t ...i>
+        static constexpr bool all_trivially_copyable(std::index_sequence<i...>) {
+            return hana::detail::fast_and<
+                std::is_trivially_copyable<detail::packed_member<S, i>>::value...
+            >::value;
+        }
+
+        static_assert(all_references(std::make_index_sequence<N>{}),
+        "hana::experimental::packed_layout<S> requires the accessors of 'S' to return references to its members");
+
+        static_assert(all_trivially_copyable(std::make_index_sequence<N>{}),
+        "hana::experimental::packed_layout<S> requires the members of 'S' to be trivially copyable");
+
+        using Order = typename detail::as_index_sequence<decltype(hana::sort(
+            hana::to_tuple(hana::range_c<std::size_t, 0, N>),
+            detail::by_decreasing_alignment<S>{}
+        ))>::type;
+
+        template <std::size_t ...i>
+        static constexpr detail::packed_layout_data<N> compute(std::index_sequence<i...>) {
+            detail::packed_layout_data<N> data{};
+            std::size_t const order[] = {i..., 0}; // avoid empty array
+            std::size_t const sizes[] = {sizeof(detail::packed_member<S, i>)..., 0};
+
+            data.size = 0;
+            for (std::size_t p = 0; p < N; ++p) {
+                data.order[p] = order[p];
+                data.offsets[order[p]] = data.size;
+                data.size += sizes[p];
+            }
+
+            std::size_t start = 0;
+            for (std::size_t p = 0; p < N; ++p) {
+                if (p != 0 && order[p] != order[p - 1] + 1)
+                    start = p;
+                ++data.runs[start];
+            }
+            return data;
+        }
+
+    public:
+        //! The computed layout.
+        static constexpr detail::packed_layout_data<N> data = compute(Order{});
+
+        //! The size of the packed representation, in bytes.
+        static constexpr std::size_t size = data.size;
+
+        //! Returns the offset, in the packed representation, of the `i`-th
+        //! member in the order of `hana::accessors<S>()`.
+        static constexpr std::size_t offset(std::size_t i)
+        { return data.offsets[i]; }
+    };
+
+    template <typename S>
+    constexpr detail::packed_layout_data<packed_layout<S>::N> packed_layout<S>::data;
+
+    template <typename S>
+    constexpr std::size_t packed_layout<S>::size;
+
+    namespace detail {
+        struct pack_bytes {
+            unsigned char* out;
+
+            void operator()(std::size_t offset, void const* member, std::size_t n) const
+            { std::memcpy(out + offset, member, n); }
+        };
+
+        struct unpack_bytes {
+            unsigned char const* in;
+
+            void operator()(std::size_t offset, void* member, std::size_t n) const
+            { std::memcpy(member, in + offset, n); }
+        };
+
+        template <typename S>
+        struct packed_copy {
+            using Layout = packed_layout<S>;
+
+            template <std::size_t i, typename Object>
+            static auto* address(Object& x) {
+                auto accessors = hana::accessors<S>();
+                return std::addressof(hana::second(hana::at_c<i>(accessors))(x));
+            }
+
+            // Returns whether each of the members `first + k + 1` immediately
+            // follows the member `first + k` in `x`.
+            template <std::size_t first, std::size_t ...k, typename Object>
+            static bool adjacent(Object& x, std::index_sequence<k...>) {
+                bool const follows[] = {true, (
+                    reinterpret_cast<std::uintptr_t>(address<first + k + 1>(x)) ==
+                    reinterpret_cast<std::uintptr_t>(address<first + k>(x)) +
+                        sizeof(packed_member<S, first + k>)
+                )...};
+                for (bool f : follows)
+                    if (!f)
+                        return false;
+                return true;
+            }
+
+            // Copies the `n` members starting at position `p` of the packed
+            // representation. If each of them immediately follows the previous
+            // one in `x`, which the compiler can usually determine statically,
+            // this is done with a single copy.
+            template <std::size_t p, std::size_t ...k, typename Object, typename Copy>
+            static void copy_run(Object& x, Copy const& copy, std::index_sequence<k...>) {
+                constexpr std::size_t first = Layout::data.order[p];
+                constexpr std::size_t last = first + sizeof...(k) - 1;
+                constexpr std::size_t bytes =
+                    Layout::data.offsets[last] + sizeof(packed_member<S, last>) -
+                    Layout::data.offsets[first];
+
+                if (adjacent<first>(x, std::make_index_sequence<sizeof...(k) - 1>{})) {
+                    copy(Layout::data.offsets[first], address<first>(x), bytes);
+                } else {
+                    int expand[] = {0, ((void)copy(Layout::data.offsets[first + k],
+                                                   address<first + k>(x),
+                                                   sizeof(packed_member<S, first + k>)), 0)...};
+                    (void)expand;
+                }
+            }
+
+            template <std::size_t p, typename Object, typename Copy>
+            static void copy_position(Object& x, Copy const& copy) {
+                copy_run<p>(x, copy, std::make_index_sequence<Layout::data.runs[p]>{});
+            }
+
+            template <std::size_t p, typename Object, typename Copy>
+            static void copy_run(Object&, Copy const&, std::index_sequence<>)
+            { }
+
+            template <typename Object, typename Copy, std::size_t ...p>
+            static void apply(Object& x, Copy const& copy, std::index_sequence<p...>) {
+                int expand[] = {0, ((void)copy_position<p>(x, copy), 0)...};
+                (void)expand; (void)x; (void)copy;
+            }
+        };
+    }
+
+    //! @ingroup group-experimental
+    //! Writes the packed representation of a `Struct` to a buffer.
+    //!
+    //! `to_packed(out, x)` writes the `packed_layout<S>::size` bytes of the
+    //! packed representation of `x` starting at `out`, and returns a pointer
+    //! past the last byte written. The members that are adjacent both in
+    //! `x` and in the packed representation are copied together, with a
+    //! single call to `std::memcpy`. In particular, a `Struct` whose members
+    //! are declared in order of decreasing alignment and without padding
+    //! between them is copied at once.
+    template <typename S>
+    unsigned char* to_packed(unsigned char* out, S const& x) {
+        constexpr std::size_t N = decltype(hana::length(hana::accessors<S>()))::value;
+        detail::packed_copy<S>::apply(x, detail::pack_bytes{out},
+                                      std::make_index_sequence<N>{});
+        return out + packed_layout<S>::size;
+    }
+
+    //! @ingroup group-experimental
+    //! Reads the members of a `Struct` from its packed representation.
+    //!
+    //! `from_packed(in, x)` assigns the members of `x` from the
+    //! `packed_layout<S>::size` bytes starting at `in`, which must have
+    //! been written by `to_packed`, and returns a pointer past the last byte
+    //! read. Like for `to_packed`, runs of adjacent members are copied at
+    //! once.
+    template <typename S>
+    unsigned char const* from_packed(unsigned char const* in, S& x) {
+        constexpr std::size_t N = decltype(hana::length(hana::accessors<S>()))::value;
+        detail::packed_copy<S>::apply(x, detail::unpack_bytes{in},
+                                      std::make_index_sequence<N>{});
+        return in + packed_layout<S>::size;
+    }
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_PACKED_HPP
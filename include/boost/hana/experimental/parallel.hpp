@@ -0,0 +1,451 @@
+/*
+@file
+Defines `boost::hana::experimental::thread_pool`,
+`boost::hana::experimental::par`,
+`boost::hana::experimental::for_each` and
+`boost::hana::experimental::transform`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_PARALLEL_HPP
+#define BOOST_HANA_EXPERIMENTAL_PARALLEL_HPP
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/concept/iterable.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#   define BOOST_HANA_EXPERIMENTAL_PARALLEL_HAS_EXCEPTIONS
+#endif
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    namespace detail {
+        using parallel_task_fn = void (*)(void* context);
+
+        // The tasks created by a single call to `for_each` or `transform`.
+        // The task at index `i` is `tasks[i](context)`, and the thread that
+        // created the batch waits until all of them have been executed.
+        class parallel_batch {
+            parallel_task_fn const* tasks_;
+            void* context_;
+            std::atomic<std::size_t> remaining_;
+            std::mutex mutex_;
+            std::condition_variable finished_;
+            bool done_;
+        #ifdef BOOST_HANA_EXPERIMENTAL_PARALLEL_HAS_EXCEPTIONS
+            std::exception_ptr error_;
+        #endif
+
+        public:
+            parallel_batch(parallel_task_fn const* tasks, void* context, std::size_t size)
+                : tasks_{tasks}, context_{context}, remaining_{size}, done_{size == 0}
+            { }
+
+            bool finished() const
+            { return remaining_.load() == 0; }
+
+            void execute(std::size_t index) {
+            #ifdef BOOST_HANA_EXPERIMENTAL_PARALLEL_HAS_EXCEPTIONS
+                try {
+                    tasks_[index](context_);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock{mutex_};
+                    if (!error_)
+                        error_ = std::current_exception();
+                }
+            #else
+                tasks_[index](context_);
+            #endif
+
+                // The waiting thread only looks at `done_` with the mutex
+                // held, so the batch can't be destroyed before we're done
+                // notifying it.
+                if (remaining_.fetch_sub(1) == 1) {
+                    std::lock_guard<std::mutex> lock{mutex_};
+                    done_ = true;
+                    finished_.notify_all();
+                }
+            }
+
+            // Waits for all the tasks to be executed, and rethrows the first
+            // exception thrown by one of them, if any.
+            void wait() {
+                std::unique_lock<std::mutex> lock{mutex_};
+                finished_.wait(lock, [this] { return done_; });
+            #ifdef BOOST_HANA_EXPERIMENTAL_PARALLEL_HAS_EXCEPTIONS
+                if (error_)
+                    std::rethrow_exception(error_);
+            #endif
+            }
+        };
+
+        struct parallel_task {
+            parallel_batch* batch;
+            std::size_t index;
+        };
+    }
+
+    //! @ingroup group-experimental
+    //! Fixed-size pool of threads executing the work of the parallel
+    //! `for_each` and `transform`.
+    //!
+    //! Each worker thread has its own queue of tasks. The tasks of a batch
+    //! are spread over all the queues, and a worker whose queue is empty
+    //! steals tasks from the other queues, so that the load stays balanced
+    //! even when the tasks take very different amounts of time. The thread
+    //! waiting for a batch also executes tasks until there are none left to
+    //! start, so a pool with `n` workers runs up to `n + 1` tasks at once,
+    //! and using the pool from one of its own tasks can't deadlock.
+    //!
+    //! A pool with no worker threads is valid, and runs everything on the
+    //! calling thread. The pool must outlive any call using it.
+    class thread_pool {
+        struct queue {
+            std::mutex mutex;
+            std::deque<detail::parallel_task> tasks;
+        };
+
+        // Not `workers_.size()`, since the workers use it while the
+        // vector is being filled.
+        std::size_t const threads_;
+        std::unique_ptr<queue[]> queues_;
+        std::vector<std::thread> workers_;
+        std::atomic<std::size_t> queued_;
+        std::atomic<std::size_t> next_;
+        std::mutex mutex_;
+        std::condition_variable wake_;
+        bool stop_;
+
+        bool take_back(std::size_t q, detail::parallel_task& task) {
+            std::lock_guard<std::mutex> lock{queues_[q].mutex};
+            if (queues_[q].tasks.empty())
+                return false;
+            task = queues_[q].tasks.back();
+            queues_[q].tasks.pop_back();
+            --queued_;
+            return true;
+        }
+
+        bool take_front(std::size_t q, detail::parallel_task& task) {
+            std::lock_guard<std::mutex> lock{queues_[q].mutex};
+            if (queues_[q].tasks.empty())
+                return false;
+            task = queues_[q].tasks.front();
+            queues_[q].tasks.pop_front();
+            --queued_;
+            return true;
+        }
+
+        bool steal(std::size_t first, detail::parallel_task& task) {
+            std::size_t const n = threads_;
+            for (std::size_t k = 0; k != n; ++k) {
+                if (take_front((first + k) % n, task))
+                    return true;
+            }
+            return false;
+        }
+
+        void work(std::size_t self) {
+            detail::parallel_task task;
+            while (true) {
+                if (take_back(self, task) || steal(self + 1, task)) {
+                    task.batch->execute(task.index);
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock{mutex_};
+                wake_.wait(lock, [this] { return stop_ || queued_.load() != 0; });
+                if (stop_)
+                    return;
+            }
+        }
+
+        void stop() {
+            {
+                std::lock_guard<std::mutex> lock{mutex_};
+                stop_ = true;
+            }
+            wake_.notify_all();
+            for (std::thread& worker : workers_)
+                worker.join();
+        }
+
+    public:
+        //! Starts a pool with `threads` worker threads.
+        explicit thread_pool(std::size_t threads)
+            : threads_{threads}, queues_{new queue[threads == 0 ? 1 : threads]}
+            , queued_{0}, next_{0}, stop_{false}
+        {
+            workers_.reserve(threads);
+        #ifdef BOOST_HANA_EXPERIMENTAL_PARALLEL_HAS_EXCEPTIONS
+            try {
+                for (std::size_t i = 0; i != threads; ++i)
+                    workers_.emplace_back([this, i] { work(i); });
+            } catch (...) {
+                stop();
+                throw;
+            }
+        #else
+            for (std::size_t i = 0; i != threads; ++i)
+                workers_.emplace_back([this, i] { work(i); });
+        #endif
+        }
+
+        thread_pool(thread_pool const&) = delete;
+        thread_pool& operator=(thread_pool const&) = delete;
+
+        //! Joins the worker threads.
+        ~thread_pool()
+        { stop(); }
+
+        //! Returns the number of worker threads.
+        std::size_t size() const
+        { return threads_; }
+
+        //! @cond
+        // Executes all the tasks of a batch, and waits for them.
+        void run(detail::parallel_batch& batch, std::size_t size) {
+            std::size_t const n = threads_;
+            if (n == 0) {
+                for (std::size_t i = 0; i != size; ++i)
+                    batch.execute(i);
+                batch.wait();
+                return;
+            }
+
+            std::size_t const first = next_.fetch_add(size);
+            for (std::size_t i = 0; i != size; ++i) {
+                queue& q = queues_[(first + i) % n];
+                std::lock_guard<std::mutex> lock{q.mutex};
+                q.tasks.push_back({&batch, i});
+                ++queued_;
+            }
+
+            // See `work()`; taking the lock makes sure that no worker
+            // misses the update of `queued_` before going to sleep.
+            { std::lock_guard<std::mutex> lock{mutex_}; }
+            wake_.notify_all();
+
+            detail::parallel_task task;
+            while (!batch.finished() && steal(first, task))
+                task.batch->execute(task.index);
+            batch.wait();
+        }
+        //! @endcond
+    };
+
+    namespace detail {
+        inline thread_pool& default_thread_pool() {
+            static thread_pool pool{
+                std::thread::hardware_concurrency() > 1
+                    ? std::thread::hardware_concurrency() - 1
+                    : 0
+            };
+            return pool;
+        }
+
+        template <typename Xs, typename F, typename Indices>
+        struct parallel_for_each;
+
+        template <typename Xs, typename F, std::size_t ...i>
+        struct parallel_for_each<Xs, F, std::index_sequence<i...>> {
+            typename std::remove_reference<Xs>::type* xs;
+            typename std::remove_reference<F>::type* f;
+
+            template <std::size_t n>
+            static void call(void* context) {
+                auto& self = *static_cast<parallel_for_each*>(context);
+                (*self.f)(hana::at_c<n>(static_cast<Xs&&>(*self.xs)));
+            }
+
+            static parallel_task_fn const* tasks() {
+                static parallel_task_fn const table[] = {&call<i>..., nullptr};
+                return table;
+            }
+        };
+
+        // Storage for a result of `transform` that is constructed by one of
+        // the tasks, possibly on another thread.
+        template <typename T>
+        class parallel_result {
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type storage_;
+            bool constructed_ = false;
+
+        public:
+            parallel_result() = default;
+            parallel_result(parallel_result const&) = delete;
+            parallel_result& operator=(parallel_result const&) = delete;
+
+            template <typename X>
+            void construct(X&& x) {
+                ::new (static_cast<void*>(&storage_)) T(static_cast<X&&>(x));
+                constructed_ = true;
+            }
+
+            T& get()
+            { return *reinterpret_cast<T*>(&storage_); }
+
+            ~parallel_result()
+            { if (constructed_) get().~T(); }
+        };
+
+        template <typename Xs, typename F, std::size_t n>
+        using parallel_transform_result = typename hana::detail::decay<decltype(
+            std::declval<F&>()(hana::at_c<n>(std::declval<Xs>()))
+        )>::type;
+
+        template <typename Xs, typename F, typename Indices>
+        struct parallel_transform;
+
+        template <typename Xs, typename F, std::size_t ...i>
+        struct parallel_transform<Xs, F, std::index_sequence<i...>> {
+            typename std::remove_reference<Xs>::type* xs;
+            typename std::remove_reference<F>::type* f;
+            hana::basic_tuple<
+                parallel_result<parallel_transform_result<Xs, F, i>>...
+            > results;
+
+            template <std::size_t n>
+            static void call(void* context) {
+                auto& self = *static_cast<parallel_transform*>(context);
+                hana::at_c<n>(self.results).construct(
+                    (*self.f)(hana::at_c<n>(static_cast<Xs&&>(*self.xs)))
+                );
+            }
+
+            static parallel_task_fn const* tasks() {
+                static parallel_task_fn const table[] = {&call<i>..., nullptr};
+                return table;
+            }
+
+            hana::tuple<parallel_transform_result<Xs, F, i>...> get() {
+                return hana::tuple<parallel_transform_result<Xs, F, i>...>{
+                    std::move(hana::at_c<i>(results).get())...
+                };
+            }
+        };
+    }
+
+    //! @cond
+    struct parallel_policy {
+        thread_pool& pool;
+    };
+
+    struct par_t {
+        parallel_policy on(thread_pool& pool) const
+        { return {pool}; }
+    };
+
+    namespace detail {
+        inline thread_pool& pool_of(par_t const&)
+        { return default_thread_pool(); }
+
+        inline thread_pool& pool_of(parallel_policy const& policy)
+        { return policy.pool; }
+    }
+    //! @endcond
+
+    //! @ingroup group-experimental
+    //! Execution policy requesting that the elements of a sequence be
+    //! processed in parallel.
+    //!
+    //! `par` can be passed as the first argument of the parallel versions
+    //! of `for_each` and `transform` provided in the `experimental`
+    //! namespace. By default, the work is done on a `thread_pool` shared by
+    //! the whole program, whose size is the number of hardware threads minus
+    //! one, since the calling thread also does some of the work. To use a
+    //! pool of a given size instead, use `par.on(pool)`.
+    //!
+    //! Only the elements themselves are processed in parallel, so this is
+    //! only useful when the function applied to each element does enough
+    //! work to amortize the cost of handing it over to another thread.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/parallel.cpp
+    constexpr par_t par{};
+
+    //! @cond
+    struct for_each_t {
+        template <typename Policy, typename Xs, typename F>
+        void operator()(Policy const& policy, Xs&& xs, F&& f) const {
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(hana::Iterable<typename hana::tag_of<Xs>::type>::value,
+            "hana::experimental::for_each(policy, xs, f) requires 'xs' to be Iterable");
+        #endif
+
+            constexpr std::size_t N = decltype(hana::length(xs))::value;
+            using Indices = std::make_index_sequence<N>;
+            detail::parallel_for_each<Xs&&, F&&, Indices> context{&xs, &f};
+            detail::parallel_batch batch{context.tasks(), &context, N};
+            detail::pool_of(policy).run(batch, N);
+        }
+    };
+
+    struct transform_t {
+        template <typename Policy, typename Xs, typename F>
+        auto operator()(Policy const& policy, Xs&& xs, F&& f) const {
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(hana::Iterable<typename hana::tag_of<Xs>::type>::value,
+            "hana::experimental::transform(policy, xs, f) requires 'xs' to be Iterable");
+        #endif
+
+            constexpr std::size_t N = decltype(hana::length(xs))::value;
+            using Indices = std::make_index_sequence<N>;
+            detail::parallel_transform<Xs&&, F&&, Indices> context{&xs, &f, {}};
+            detail::parallel_batch batch{context.tasks(), &context, N};
+            detail::pool_of(policy).run(batch, N);
+            return context.get();
+        }
+    };
+    //! @endcond
+
+    //! @ingroup group-experimental
+    //! Parallel version of `hana::for_each`.
+    //!
+    //! `for_each(policy, xs, f)` calls `f` on every element of the
+    //! `Iterable` `xs`, like `hana::for_each(xs, f)`, except the calls are
+    //! made concurrently on the threads of the pool selected by `policy`,
+    //! which is `par` or `par.on(pool)`, and in no particular order. Hence,
+    //! `f` must be safe to call concurrently with different elements. This
+    //! returns once all the calls are done; if any of them throws, one of
+    //! the exceptions is rethrown at that point.
+    constexpr for_each_t for_each{};
+
+    //! @ingroup group-experimental
+    //! Parallel version of `hana::transform`.
+    //!
+    //! `transform(policy, xs, f)` returns a `hana::tuple` containing the
+    //! results of `f(x)` for every element `x` of the `Iterable` `xs`, in
+    //! the same order, but with the calls made concurrently as for the
+    //! parallel `for_each`. Like for `hana::make_tuple`, the results are
+    //! stored by value.
+    constexpr transform_t transform{};
+} BOOST_HANA_NAMESPACE_END
+
+#undef BOOST_HANA_EXPERIMENTAL_PARALLEL_HAS_EXCEPTIONS
+
+#endif // !BOOST_HANA_EXPERIMENTAL_PARALLEL_HPP
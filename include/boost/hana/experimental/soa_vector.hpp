@@ -0,0 +1,572 @@
+/*
+@file
+Defines `boost::hana::experimental::soa_vector`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_SOA_VECTOR_HPP
+#define BOOST_HANA_EXPERIMENTAL_SOA_VECTOR_HPP
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/index_if.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    namespace detail {
+        template <typename S>
+        using soa_accessors = decltype(hana::accessors<S>());
+
+        template <typename S, std::size_t i>
+        using soa_member_ref = decltype(
+            hana::second(hana::at_c<i>(std::declval<soa_accessors<S>>()))(
+                std::declval<S&>()
+            )
+        );
+
+        template <typename S, std::size_t i>
+        using soa_member = typename std::remove_cv<
+            typename std::remove_reference<soa_member_ref<S, i>>::type
+        >::type;
+
+        template <typename S, std::size_t i>
+        using soa_key = typename hana::detail::decay<decltype(
+            hana::first(hana::at_c<i>(std::declval<soa_accessors<S>>()))
+        )>::type;
+
+        // Returns storage for `n` objects of type `T`, aligned on (at least)
+        // a cache line so that loops over a column can be vectorized without
+        // peeling. The pointer returned by `::operator new` is stored right
+        // before the aligned block, so it can be recovered when the block is
+        // freed.
+        template <typename T>
+        T* soa_allocate(std::size_t n) {
+            constexpr std::size_t alignment = alignof(T) > 64 ? alignof(T) : 64;
+            constexpr std::size_t max = static_cast<std::size_t>(-1);
+
+            // On overflow, ask for a size that can't be allocated, so that
+            // `::operator new` reports the failure like it usually does.
+            std::size_t bytes = n > (max - alignment - sizeof(void*)) / sizeof(T)
+                ? max
+                : n * sizeof(T) + alignment + sizeof(void*);
+
+            void* raw = ::operator new(bytes);
+            std::uintptr_t address = reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*);
+            address = (address + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+            reinterpret_cast<void**>(address)[-1] = raw;
+            return reinterpret_cast<T*>(address);
+        }
+
+        template <typename T>
+        void soa_deallocate(T* p) {
+            if (p)
+                ::operator delete(reinterpret_cast<void**>(p)[-1]);
+        }
+
+        // The storage of one of the members. Unlike `std::vector`, this
+        // keeps track of neither its size nor its capacity, which are the
+        // same for all the columns and are stored in the `soa_vector`.
+        template <typename T>
+        class soa_column {
+            T* data_ = nullptr;
+
+        public:
+            soa_column() = default;
+            soa_column(soa_column const&) = delete;
+            soa_column& operator=(soa_column const&) = delete;
+
+            soa_column(soa_column&& other) noexcept
+                : data_{other.data_}
+            { other.data_ = nullptr; }
+
+            ~soa_column()
+            { soa_deallocate(data_); }
+
+            void swap(soa_column& other) noexcept
+            { std::swap(data_, other.data_); }
+
+            T* data() const
+            { return data_; }
+
+            // Constructs the elements in [first, last) with `construct(p, k)`,
+            // which must construct the `k`-th element at `p`. If that throws,
+            // the elements constructed so far are destroyed.
+            template <typename Construct>
+            void construct(std::size_t first, std::size_t last, Construct const& construct) {
+                struct guard {
+                    T* data;
+                    std::size_t first, current;
+                    ~guard() {
+                        for (std::size_t k = first; k != current; ++k)
+                            data[k].~T();
+                    }
+                } g{data_, first, first};
+
+                for (; g.current != last; ++g.current)
+                    construct(static_cast<void*>(data_ + g.current), g.current);
+                g.first = last;
+            }
+
+            void destroy(std::size_t first, std::size_t last) {
+                for (std::size_t k = first; k != last; ++k)
+                    data_[k].~T();
+            }
+
+            // Moves the first `size` elements to a new block with room for
+            // `capacity` elements.
+            void reallocate(std::size_t size, std::size_t capacity) {
+                soa_column fresh;
+                fresh.data_ = soa_allocate<T>(capacity);
+                T* old = data_;
+                fresh.construct(0, size, [old](void* p, std::size_t k) {
+                    ::new (p) T(std::move_if_noexcept(old[k]));
+                });
+                destroy(0, size);
+                swap(fresh);
+            }
+        };
+
+        template <typename S, typename Indices>
+        struct soa_columns;
+
+        template <typename S, std::size_t ...i>
+        struct soa_columns<S, std::index_sequence<i...>> {
+            using type = hana::basic_tuple<soa_column<soa_member<S, i>>...>;
+        };
+
+        template <std::size_t n>
+        struct soa_row_accessor {
+            template <typename Row>
+            constexpr decltype(auto) operator()(Row const& row) const
+            { return row.template get<n>(); }
+        };
+    }
+
+    //! @ingroup group-experimental
+    //! Contiguous view of one of the columns of a `soa_vector`.
+    //!
+    //! This is a pointer and a size, which are invalidated by any operation
+    //! changing the capacity of the `soa_vector`. The data is aligned on
+    //! (at least) 64 bytes.
+    template <typename T>
+    class soa_span {
+        T* data_;
+        std::size_t size_;
+
+    public:
+        constexpr soa_span(T* data, std::size_t size)
+            : data_{data}, size_{size}
+        { }
+
+        constexpr T* data() const { return data_; }
+        constexpr std::size_t size() const { return size_; }
+        constexpr bool empty() const { return size_ == 0; }
+        constexpr T* begin() const { return data_; }
+        constexpr T* end() const { return data_ + size_; }
+        constexpr T& operator[](std::size_t i) const { return data_[i]; }
+    };
+
+    template <typename S>
+    class soa_vector;
+
+    //! @ingroup group-experimental
+    //! Reference to a row of a `soa_vector`.
+    //!
+    //! Since the members of a row are not stored together, a row can't be
+    //! referred to with an actual reference. Instead, this proxy holds the
+    //! `soa_vector` and the index of the row. It is a `Struct` with the same
+    //! keys as `S`, whose members are references to the elements of the
+    //! row, so `hana::at_key(row, key)` can be used to access them, and
+    //! generic code written for `S` will often work unchanged. `Vector` is
+    //! either `soa_vector<S>` or `soa_vector<S> const`, in which case the
+    //! members can't be modified.
+    template <typename Vector>
+    class soa_reference {
+        using S = typename std::remove_const<Vector>::type::value_type;
+        static constexpr std::size_t N = std::remove_const<Vector>::type::member_count;
+
+        Vector* vector_;
+        std::size_t index_;
+
+        template <std::size_t ...n>
+        static constexpr auto make_accessors(std::index_sequence<n...>) {
+            return hana::make_tuple(
+                hana::make_pair(detail::soa_key<S, n>{}, detail::soa_row_accessor<n>{})...
+            );
+        }
+
+        template <std::size_t ...n>
+        S materialize(std::index_sequence<n...>) const {
+            S s{};
+            auto accessors = hana::accessors<S>();
+            int expand[] = {0, ((void)(
+                hana::second(hana::at_c<n>(accessors))(s) = get<n>()
+            ), 0)...};
+            (void)expand; (void)accessors;
+            return s;
+        }
+
+        template <typename Row, std::size_t ...n>
+        void assign_row(Row const& other, std::index_sequence<n...>) const {
+            int expand[] = {0, ((void)(get<n>() = other.template get<n>()), 0)...};
+            (void)expand; (void)other;
+        }
+
+        template <typename X, std::size_t ...n>
+        void assign_struct(X&& x, std::index_sequence<n...>) const {
+            auto accessors = hana::accessors<S>();
+            int expand[] = {0, ((void)(
+                get<n>() = hana::second(hana::at_c<n>(accessors))(static_cast<X&&>(x))
+            ), 0)...};
+            (void)expand; (void)accessors; (void)x;
+        }
+
+    public:
+        struct hana_accessors_impl {
+            static constexpr auto apply()
+            { return make_accessors(std::make_index_sequence<N>{}); }
+        };
+
+        constexpr soa_reference(Vector& vector, std::size_t index)
+            : vector_{&vector}, index_{index}
+        { }
+
+        soa_reference(soa_reference const&) = default;
+
+        //! Converts a reference to a mutable row to a reference to a
+        //! constant row.
+        template <typename V, typename = std::enable_if_t<
+            std::is_same<Vector, V const>::value
+        >>
+        constexpr soa_reference(soa_reference<V> const& other)
+            : vector_{other.vector_}, index_{other.index_}
+        { }
+
+        //! Returns the element of the row for the `n`-th member of `S`,
+        //! in the order of `hana::accessors<S>()`.
+        template <std::size_t n>
+        decltype(auto) get() const
+        { return vector_->template element<n>(index_); }
+
+        //! Returns a copy of the row as an `S`, which must be default
+        //! constructible.
+        operator S() const
+        { return materialize(std::make_index_sequence<N>{}); }
+
+        //! Assigns the members of another row, or of an `S`, to the members
+        //! of this row. Like for actual references, the row this refers to
+        //! stays the same.
+        soa_reference const& operator=(soa_reference const& other) const {
+            assign_row(other, std::make_index_sequence<N>{});
+            return *this;
+        }
+
+        template <typename V>
+        soa_reference const& operator=(soa_reference<V> const& other) const {
+            assign_row(other, std::make_index_sequence<N>{});
+            return *this;
+        }
+
+        soa_reference const& operator=(S const& s) const {
+            assign_struct(s, std::make_index_sequence<N>{});
+            return *this;
+        }
+
+        soa_reference const& operator=(S&& s) const {
+            assign_struct(std::move(s), std::make_index_sequence<N>{});
+            return *this;
+        }
+
+        template <typename V>
+        friend class soa_reference;
+    };
+
+    //! @ingroup group-experimental
+    //! Sequence of `Struct`s stored as a structure of arrays.
+    //!
+    //! Instead of storing whole objects next to each other, `soa_vector<S>`
+    //! keeps one contiguous array per member of the `Struct` `S`, as
+    //! described by `hana::accessors<S>()`. A loop that only looks at some
+    //! of the members then only brings those members into the cache, and
+    //! since the elements of each array are contiguous and aligned, the
+    //! compiler can usually vectorize it.
+    //!
+    //! The arrays are accessed with `column(key)`, which returns a
+    //! `soa_span` over the elements for the member with that key, and
+    //! `operator[]` returns a `soa_reference` to a whole row. The accessors
+    //! of `S` must return references to its members, and none of these
+    //! members can be an array.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/soa_vector.cpp
+    template <typename S>
+    class soa_vector {
+        static_assert(hana::Struct<S>::value,
+        "hana::experimental::soa_vector<S> requires 'S' to be a Struct");
+
+    public:
+        using value_type = S;
+        using size_type = std::size_t;
+        using reference = soa_reference<soa_vector>;
+        using const_reference = soa_reference<soa_vector const>;
+
+        //! @cond
+        static constexpr std::size_t member_count =
+            decltype(hana::length(std::declval<detail::soa_accessors<S>>()))::value;
+        //! @endcond
+
+    private:
+        using Indices = std::make_index_sequence<member_count>;
+
+        template <std::size_t ...i>
+        static constexpr bool all_references(std::index_sequence<i...>) {
+            return hana::detail::fast_and<
+                std::is_lvalue_reference<detail::soa_member_ref<S, i>>::value...
+            >::value;
+        }
+
+        static_assert(all_references(Indices{}),
+        "hana::experimental::soa_vector<S> requires the accessors of 'S' to return references to its members");
+
+        typename detail::soa_columns<S, Indices>::type columns_;
+        size_type size_ = 0;
+        size_type capacity_ = 0;
+
+        template <typename Key>
+        using index_of = hana::detail::index_if<
+            decltype(hana::equal.to(std::declval<Key>())),
+            typename hana::detail::make_pack<decltype(hana::keys(std::declval<S>()))>::type
+        >;
+
+        template <typename Key>
+        static constexpr std::size_t column_index() {
+            constexpr std::size_t i = index_of<Key>::value;
+            static_assert(i != member_count,
+            "hana::experimental::soa_vector<S>::column(key) requires 'key' to be a key of 'S'");
+            return i;
+        }
+
+        template <std::size_t n>
+        detail::soa_member<S, n>& element(size_type k)
+        { return hana::at_c<n>(columns_).data()[k]; }
+
+        template <std::size_t n>
+        detail::soa_member<S, n> const& element(size_type k) const
+        { return hana::at_c<n>(columns_).data()[k]; }
+
+        template <std::size_t ...i>
+        void destroy(size_type first, size_type last, std::index_sequence<i...>) {
+            int expand[] = {0, ((void)hana::at_c<i>(columns_).destroy(first, last), 0)...};
+            (void)expand; (void)first; (void)last;
+        }
+
+        // Destroys the elements in [first, last) of the first `columns`
+        // columns, unless it is disarmed by setting `self` to null. This
+        // makes sure that all the columns keep the same number of elements
+        // when constructing an element throws.
+        struct rollback {
+            soa_vector* self;
+            size_type first, last, columns;
+
+            template <std::size_t ...i>
+            void apply(std::index_sequence<i...>) {
+                int expand[] = {0, ((void)(
+                    i < columns ? hana::at_c<i>(self->columns_).destroy(first, last) : (void)0
+                ), 0)...};
+                (void)expand;
+            }
+
+            ~rollback()
+            { if (self) apply(Indices{}); }
+        };
+
+        // Constructs the elements in [first, last) of every column. The
+        // `k`-th element of the `i`-th column is constructed at `p` with
+        // `construct(std::integral_constant<std::size_t, i>{}, p, k)`.
+        template <typename Construct, std::size_t ...i>
+        void construct(size_type first, size_type last, Construct const& construct,
+                       std::index_sequence<i...>)
+        {
+            rollback guard{this, first, last, 0};
+            int expand[] = {0, ((void)(
+                hana::at_c<i>(columns_).construct(first, last, [&](void* p, size_type k) {
+                    construct(std::integral_constant<std::size_t, i>{}, p, k);
+                }),
+                ++guard.columns
+            ), 0)...};
+            (void)expand; (void)construct;
+            guard.self = nullptr;
+        }
+
+        template <std::size_t ...i>
+        void reallocate(size_type capacity, std::index_sequence<i...>) {
+            int expand[] = {0, ((void)hana::at_c<i>(columns_).reallocate(size_, capacity), 0)...};
+            (void)expand; (void)capacity;
+        }
+
+        template <typename X>
+        void push_back_impl(X&& x) {
+            if (size_ == capacity_)
+                reserve(capacity_ == 0 ? 8 : 2 * capacity_);
+
+            auto accessors = hana::accessors<S>();
+            construct(size_, size_ + 1, [&](auto i, void* p, size_type) {
+                ::new (p) detail::soa_member<S, decltype(i)::value>(
+                    hana::second(hana::at_c<decltype(i)::value>(accessors))(static_cast<X&&>(x))
+                );
+            }, Indices{});
+            ++size_;
+        }
+
+        template <std::size_t ...i>
+        void swap_columns(soa_vector& other, std::index_sequence<i...>) {
+            int expand[] = {0, ((void)hana::at_c<i>(columns_).swap(hana::at_c<i>(other.columns_)), 0)...};
+            (void)expand; (void)other;
+        }
+
+    public:
+        soa_vector() = default;
+
+        //! Creates a `soa_vector` with `n` value-initialized rows.
+        explicit soa_vector(size_type n)
+        { resize(n); }
+
+        soa_vector(soa_vector const& other) {
+            reserve(other.size_);
+            construct(0, other.size_, [&other](auto i, void* p, size_type k) {
+                ::new (p) detail::soa_member<S, decltype(i)::value>(
+                    other.template element<decltype(i)::value>(k)
+                );
+            }, Indices{});
+            size_ = other.size_;
+        }
+
+        soa_vector(soa_vector&& other) noexcept
+            : columns_{std::move(other.columns_)}, size_{other.size_}, capacity_{other.capacity_}
+        {
+            other.size_ = 0;
+            other.capacity_ = 0;
+        }
+
+        soa_vector& operator=(soa_vector const& other) {
+            soa_vector copy{other};
+            swap(copy);
+            return *this;
+        }
+
+        soa_vector& operator=(soa_vector&& other) noexcept {
+            soa_vector moved{std::move(other)};
+            swap(moved);
+            return *this;
+        }
+
+        ~soa_vector()
+        { destroy(0, size_, Indices{}); }
+
+        void swap(soa_vector& other) noexcept {
+            swap_columns(other, Indices{});
+            std::swap(size_, other.size_);
+            std::swap(capacity_, other.capacity_);
+        }
+
+        size_type size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+        size_type capacity() const { return capacity_; }
+
+        void reserve(size_type n) {
+            if (n <= capacity_)
+                return;
+            reallocate(n, Indices{});
+            capacity_ = n;
+        }
+
+        //! Appends value-initialized rows, or removes rows at the end, so
+        //! that there are `n` rows.
+        void resize(size_type n) {
+            if (n > size_) {
+                reserve(n);
+                construct(size_, n, [](auto i, void* p, size_type) {
+                    ::new (p) detail::soa_member<S, decltype(i)::value>();
+                }, Indices{});
+            } else {
+                destroy(n, size_, Indices{});
+            }
+            size_ = n;
+        }
+
+        void clear() {
+            destroy(0, size_, Indices{});
+            size_ = 0;
+        }
+
+        //! Appends the members of `x` at the end of each column.
+        void push_back(S const& x)
+        { push_back_impl(x); }
+
+        void push_back(S&& x)
+        { push_back_impl(std::move(x)); }
+
+        void pop_back() {
+            destroy(size_ - 1, size_, Indices{});
+            --size_;
+        }
+
+        reference operator[](size_type i)
+        { return reference{*this, i}; }
+
+        const_reference operator[](size_type i) const
+        { return const_reference{*this, i}; }
+
+        //! Returns a `soa_span` over the elements of the member whose key
+        //! is `key`, e.g. `v.column(BOOST_HANA_STRING("price"))`.
+        template <typename Key>
+        auto column(Key const&) {
+            constexpr std::size_t i = column_index<Key>();
+            return soa_span<detail::soa_member<S, i>>{
+                hana::at_c<i>(columns_).data(), size_
+            };
+        }
+
+        template <typename Key>
+        auto column(Key const&) const {
+            constexpr std::size_t i = column_index<Key>();
+            return soa_span<detail::soa_member<S, i> const>{
+                hana::at_c<i>(columns_).data(), size_
+            };
+        }
+
+        template <typename Vector>
+        friend class soa_reference;
+    };
+
+    template <typename S>
+    void swap(soa_vector<S>& x, soa_vector<S>& y) noexcept
+    { x.swap(y); }
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_SOA_VECTOR_HPP
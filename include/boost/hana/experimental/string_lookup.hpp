@@ -0,0 +1,324 @@
+/*
+@file
+Defines `boost::hana::experimental::string_lookup`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_STRING_LOOKUP_HPP
+#define BOOST_HANA_EXPERIMENTAL_STRING_LOOKUP_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace detail {
+        // Reads `n <= 8` characters starting at `s` as a little-endian word.
+        // This must be usable at compile-time, so the word is assembled with
+        // shifts. For `n == 8`, compilers turn that into a single load.
+        constexpr std::uint64_t load_word(char const* s, std::size_t n) {
+            std::uint64_t word = 0;
+            for (std::size_t k = 0; k < n; ++k)
+                word |= std::uint64_t{static_cast<unsigned char>(s[k])} << (8 * k);
+            return word;
+        }
+
+        constexpr std::uint64_t load_word(char const* s) {
+            return  std::uint64_t{static_cast<unsigned char>(s[0])}
+                 | (std::uint64_t{static_cast<unsigned char>(s[1])} << 8)
+                 | (std::uint64_t{static_cast<unsigned char>(s[2])} << 16)
+                 | (std::uint64_t{static_cast<unsigned char>(s[3])} << 24)
+                 | (std::uint64_t{static_cast<unsigned char>(s[4])} << 32)
+                 | (std::uint64_t{static_cast<unsigned char>(s[5])} << 40)
+                 | (std::uint64_t{static_cast<unsigned char>(s[6])} << 48)
+                 | (std::uint64_t{static_cast<unsigned char>(s[7])} << 56);
+        }
+
+        // Hashes the `n` characters starting at `s`, a word at a time.
+        constexpr std::uint64_t hash_chars(char const* s, std::size_t n) {
+            std::uint64_t h = 0xcbf29ce484222325ull ^ n;
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                h = (h ^ detail::load_word(s + i)) * 0x9e3779b97f4a7c15ull;
+                h ^= h >> 32;
+            }
+            if (i < n) {
+                h = (h ^ detail::load_word(s + i, n - i)) * 0x9e3779b97f4a7c15ull;
+                h ^= h >> 32;
+            }
+            return h;
+        }
+
+        // Compares the `n` characters starting at `s1` and `s2`, a word at
+        // a time.
+        constexpr bool equal_chars(char const* s1, char const* s2, std::size_t n) {
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8)
+                if (detail::load_word(s1 + i) != detail::load_word(s2 + i))
+                    return false;
+            return detail::load_word(s1 + i, n - i) == detail::load_word(s2 + i, n - i);
+        }
+
+        // Derives a new hash from `h` and a `seed`. This is the finalizer
+        // of splitmix64, which makes every bit of the result depend on
+        // every bit of its input.
+        constexpr std::uint64_t rehash(std::uint64_t h, std::uint64_t seed) {
+            h += (seed + 1) * 0x9e3779b97f4a7c15ull;
+            h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ull;
+            h = (h ^ (h >> 27)) * 0x94d049bb133111ebull;
+            return h ^ (h >> 31);
+        }
+
+        // Minimal perfect hash table built with the "hash and displace"
+        // method. The `N` keys are first distributed in `N` buckets using
+        // their hash. Then, starting with the largest buckets, we look for
+        // a seed that sends all the keys of a bucket to free slots when
+        // they are rehashed with it. The slot of a key is then
+        //
+        //     rehash(hash, seeds[hash % N]) % N
+        //
+        // and `indices` maps each slot to the index of its key.
+        template <std::size_t N>
+        struct perfect_hash_table {
+            detail::array<std::uint64_t, N> seeds;
+            detail::array<std::size_t, N> indices;
+            bool valid;
+
+            constexpr std::size_t slot(std::uint64_t h) const
+            { return detail::rehash(h, seeds[h % N]) % N; }
+        };
+
+        template <std::size_t N>
+        constexpr perfect_hash_table<N>
+        make_perfect_hash_table(detail::array<std::uint64_t, N> const& hashes) {
+            perfect_hash_table<N> table{};
+
+            // Group the keys by bucket. The keys of bucket `b` end up in
+            // `keys[first[b]]` to `keys[first[b + 1] - 1]`.
+            detail::array<std::size_t, N + 1> first{};
+            for (std::size_t i = 0; i < N; ++i)
+                ++first[hashes[i] % N + 1];
+            for (std::size_t b = 0; b < N; ++b)
+                first[b + 1] += first[b];
+
+            detail::array<std::size_t, N> keys{};
+            detail::array<std::size_t, N + 1> next = first;
+            for (std::size_t i = 0; i < N; ++i)
+                keys[next[hashes[i] % N]++] = i;
+
+            // Order the buckets by decreasing size, using a counting sort.
+            detail::array<std::size_t, N + 1> by_size{};
+            for (std::size_t b = 0; b < N; ++b)
+                ++by_size[N - (first[b + 1] - first[b])];
+            for (std::size_t size = 0; size < N; ++size)
+                by_size[size + 1] += by_size[size];
+
+            detail::array<std::size_t, N> order{};
+            for (std::size_t b = N; b > 0; --b)
+                order[--by_size[N - (first[b] - first[b - 1])]] = b - 1;
+
+            // Find a seed for each bucket.
+            detail::array<bool, N> taken{};
+            detail::array<std::size_t, N> slots{};
+            for (std::size_t o = 0; o < N; ++o) {
+                std::size_t const b = order[o];
+                std::size_t const size = first[b + 1] - first[b];
+                if (size == 0)
+                    break;
+
+                for (std::uint64_t seed = 0; ; ++seed) {
+                    // Keys with equal hashes can't be told apart by any seed.
+                    if (seed == 64 * N + 256)
+                        return table;
+
+                    bool found = true;
+                    for (std::size_t k = 0; k < size && found; ++k) {
+                        std::uint64_t h = hashes[keys[first[b] + k]];
+                        slots[k] = detail::rehash(h, seed) % N;
+                        found = !taken[slots[k]];
+                        for (std::size_t j = 0; j < k && found; ++j)
+                            found = slots[j] != slots[k];
+                    }
+
+                    if (found) {
+                        for (std::size_t k = 0; k < size; ++k) {
+                            taken[slots[k]] = true;
+                            table.indices[slots[k]] = keys[first[b] + k];
+                        }
+                        table.seeds[b] = seed;
+                        break;
+                    }
+                }
+            }
+
+            table.valid = true;
+            return table;
+        }
+    }
+
+    namespace experimental {
+        //! @ingroup group-experimental
+        //! Runtime lookup of strings among a set of compile-time strings.
+        //!
+        //! Given compile-time strings `Keys...`, `string_lookup<Keys...>`
+        //! provides a way to find which of these keys is equal to a string
+        //! that is only known at runtime, for example a key parsed from JSON.
+        //! The lookup does not compare the runtime string with each key in
+        //! turn. Instead, a minimal perfect hash table is built at compile
+        //! time, and a lookup costs one hash of the runtime string, one
+        //! comparison with the only key that can match, and an indirect
+        //! call through a jump table when a visitor is used.
+        //!
+        //! The keys must be distinct `hana::string`s. `string_lookup` is
+        //! usually created from the keys of a `hana::map` or from the names
+        //! of the members of a `Struct` with `make_string_lookup`.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @include example/experimental/string_lookup.cpp
+        template <typename ...Keys>
+        struct string_lookup {
+            static_assert(hana::detail::fast_and<
+                std::is_same<typename hana::tag_of<Keys>::type, hana::string_tag>::value...
+            >::value,
+            "hana::experimental::string_lookup<Keys...> requires all the keys to be hana::strings");
+
+            //! Returns the number of keys, which is also the value returned
+            //! by `find` when no key matches.
+            static constexpr std::size_t size()
+            { return sizeof...(Keys); }
+
+            //! Returns the index of the key equal to the `n` characters
+            //! starting at `s`, or `size()` if there is no such key.
+            static constexpr std::size_t find(char const* s, std::size_t n) {
+                return string_lookup::find_hashed(s, n, hana::detail::hash_chars(s, n));
+            }
+
+            //! Equivalent to `find(str.data(), str.size())`. This can be used
+            //! with `std::string`, `std::string_view` and similar classes.
+            template <typename String>
+            static constexpr auto find(String const& str)
+                -> decltype(string_lookup::find(str.data(), str.size()))
+            { return string_lookup::find(str.data(), str.size()); }
+
+            //! Calls `f` with the key equal to the `n` characters starting at
+            //! `s`, or calls `otherwise()` if there is no such key. The key is
+            //! passed to `f` as a `hana::string`, so it can be used to access
+            //! a `hana::map` or a `Struct` directly. The result of the call
+            //! to `f` is converted to the type returned by `otherwise()`.
+            template <typename F, typename Otherwise>
+            static decltype(auto)
+            visit(char const* s, std::size_t n, F&& f, Otherwise&& otherwise) {
+                using Result = decltype(static_cast<Otherwise&&>(otherwise)());
+                using Jump = Result(*)(F&);
+                static constexpr Jump jump[] = {
+                    &string_lookup::call<Keys, Result, F>..., nullptr // avoid empty array
+                };
+
+                std::size_t i = string_lookup::find(s, n);
+                if (i == sizeof...(Keys))
+                    return static_cast<Otherwise&&>(otherwise)();
+                return jump[i](f);
+            }
+
+            //! Equivalent to `visit(str.data(), str.size(), f, otherwise)`.
+            template <typename String, typename F, typename Otherwise>
+            static auto visit(String const& str, F&& f, Otherwise&& otherwise)
+                -> decltype(string_lookup::visit(str.data(), str.size(),
+                                                 static_cast<F&&>(f),
+                                                 static_cast<Otherwise&&>(otherwise)))
+            {
+                return string_lookup::visit(str.data(), str.size(),
+                                            static_cast<F&&>(f),
+                                            static_cast<Otherwise&&>(otherwise));
+            }
+
+        private:
+            static constexpr std::size_t N = sizeof...(Keys);
+
+            static constexpr char const* keys[N + 1] = { // avoid empty array
+                hana::to<char const*>(Keys{})..., ""
+            };
+
+            static constexpr std::size_t lengths[N + 1] = {
+                decltype(hana::length(std::declval<Keys>()))::value..., 0
+            };
+
+            static constexpr auto compute_table() {
+                hana::detail::array<std::uint64_t, N> hashes{};
+                for (std::size_t i = 0; i < N; ++i)
+                    hashes[i] = hana::detail::hash_chars(keys[i], lengths[i]);
+                return hana::detail::make_perfect_hash_table<N>(hashes);
+            }
+
+            static constexpr hana::detail::perfect_hash_table<N> table = compute_table();
+
+            static_assert(table.valid,
+            "hana::experimental::string_lookup<Keys...> requires all the keys to be distinct");
+
+            static constexpr std::size_t
+            find_hashed(char const* s, std::size_t n, std::uint64_t h) {
+                if (N == 0)
+                    return N;
+
+                std::size_t i = table.indices[table.slot(h)];
+                return lengths[i] == n && hana::detail::equal_chars(keys[i], s, n) ? i : N;
+            }
+
+            template <typename Key, typename Result, typename F>
+            static Result call(F& f)
+            { return static_cast<Result>(f(Key{})); }
+        };
+
+        template <typename ...Keys>
+        constexpr char const* string_lookup<Keys...>::keys[];
+
+        template <typename ...Keys>
+        constexpr std::size_t string_lookup<Keys...>::lengths[];
+
+        template <typename ...Keys>
+        constexpr hana::detail::perfect_hash_table<string_lookup<Keys...>::N> string_lookup<Keys...>::table;
+
+        //! @cond
+        struct make_string_lookup_t {
+            struct make {
+                template <typename ...Keys>
+                constexpr string_lookup<typename hana::detail::decay<Keys>::type...>
+                operator()(Keys const& ...) const
+                { return {}; }
+            };
+
+            template <typename Xs>
+            constexpr auto operator()(Xs&& keys) const
+            { return hana::unpack(static_cast<Xs&&>(keys), make{}); }
+        };
+        //! @endcond
+
+        //! @ingroup group-experimental
+        //! Creates a `string_lookup` from a `Foldable` containing its keys.
+        //!
+        //! The index of a key in the lookup is its position in the
+        //! `Foldable`. For example, `make_string_lookup(hana::keys(map))`
+        //! creates a lookup for the keys of a `hana::map` whose keys are
+        //! compile-time strings.
+        constexpr make_string_lookup_t make_string_lookup{};
+    }
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_STRING_LOOKUP_HPP
@@ -0,0 +1,250 @@
+/*
+@file
+Defines `boost::hana::experimental::tuple_builder`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_TUPLE_BUILDER_HPP
+#define BOOST_HANA_EXPERIMENTAL_TUPLE_BUILDER_HPP
+
+#include <boost/hana/append.hpp>
+#include <boost/hana/concat.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/empty.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstddef>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    struct tuple_builder_tag;
+
+    namespace detail {
+        // Storage for the `n`-th element of a builder. Unlike the storage of
+        // `hana::basic_tuple`, this never inherits from the element, since
+        // a builder may itself be an element of another builder.
+        template <std::size_t n, typename T>
+        struct builder_elt {
+            template <typename Y>
+            explicit constexpr builder_elt(Y&& y)
+                : value_(static_cast<Y&&>(y))
+            { }
+
+            T value_;
+        };
+
+        template <std::size_t n, typename T>
+        constexpr T const& builder_get(builder_elt<n, T> const& x)
+        { return x.value_; }
+
+        template <std::size_t n, typename T>
+        constexpr T& builder_get(builder_elt<n, T>& x)
+        { return x.value_; }
+
+        template <std::size_t n, typename T>
+        constexpr T&& builder_get(builder_elt<n, T>&& x)
+        { return static_cast<T&&>(x.value_); }
+
+        struct builder_extend { };
+
+        template <typename Prev, std::size_t ...i>
+        constexpr std::index_sequence<Prev::size_ + i...>
+        shift_indices(std::index_sequence<i...>)
+        { return {}; }
+
+        template <typename Prev, typename ...T>
+        using builder_indices = decltype(detail::shift_indices<Prev>(
+            std::index_sequence_for<T...>{}
+        ));
+    }
+
+    //! @ingroup group-experimental
+    //! Accumulates elements cheaply, and turns them into a tuple at once.
+    //!
+    //! Appending to a `hana::tuple` creates a new tuple, which instantiates
+    //! and copies the whole sequence. Building a tuple of `n` elements by
+    //! appending them one at a time is hence quadratic in the number of
+    //! instantiations, of element moves and of compiler memory. A builder
+    //! avoids that by only ever creating a single new type when elements
+    //! are added to it: it derives from the builder it was created from,
+    //! and stores the new elements alongside. The elements of a builder
+    //! can then be retrieved in a single expansion with `hana::unpack`,
+    //! or with `hana::to<S>` for any `Sequence` `S`.
+    //!
+    //! A builder is created with `make_tuple_builder(xs...)`, which is
+    //! equivalent to `hana::make<tuple_builder_tag>(xs...)`, or with
+    //! `hana::empty<tuple_builder_tag>()`. Elements are added with
+    //! `hana::append` and `hana::concat`, both of which create a single
+    //! new type regardless of the number of elements already accumulated.
+    //! Hence, the usual `hana::fold_left(xs, state, hana::append)` idiom
+    //! becomes linear when the initial state is an empty builder. Like for
+    //! `hana::make_tuple`, the elements are stored decayed.
+    //!
+    //! The exact type of a builder is unspecified; it should only be
+    //! manipulated through the functions above.
+    //!
+    //!
+    //! Modeled concepts
+    //! ----------------
+    //! 1. `Foldable`\n
+    //! `hana::unpack` passes the elements of the builder in the order in
+    //! which they were added, moving them out of rvalue builders.
+    //! `hana::length` does not need to look at the elements.
+    //!
+    //! 2. `MonadPlus` (only `append`, `concat` and `empty`)\n
+    //! These are the only operations a builder is meant for, and they are
+    //! the only ones it provides. In particular, a builder is not a `Monad`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/tuple_builder.cpp
+    template <typename ...>
+    struct tuple_builder;
+
+    //! @cond
+    template <>
+    struct tuple_builder<> {
+        static constexpr std::size_t size_ = 0;
+        using hana_tag = tuple_builder_tag;
+    };
+
+    template <typename Prev, std::size_t ...n, typename ...T>
+    struct tuple_builder<Prev, std::index_sequence<n...>, T...>
+        : Prev, detail::builder_elt<n, T>...
+    {
+        static constexpr std::size_t size_ = Prev::size_ + sizeof...(T);
+        using hana_tag = tuple_builder_tag;
+
+        template <typename P, typename ...Y>
+        constexpr tuple_builder(detail::builder_extend, P&& prev, Y&& ...y)
+            : Prev(static_cast<P&&>(prev))
+            , detail::builder_elt<n, T>(static_cast<Y&&>(y))...
+        { }
+    };
+    //! @endcond
+
+    //! @ingroup group-experimental
+    //! Function object creating a `tuple_builder` holding the given elements.
+    //!
+    //! `make_tuple_builder(xs...)` is equivalent to
+    //! `hana::make<tuple_builder_tag>(xs...)`.
+    constexpr auto make_tuple_builder = hana::make<tuple_builder_tag>;
+
+    namespace detail {
+        template <typename Builder, typename ...T>
+        using extended_builder = tuple_builder<
+            Builder, detail::builder_indices<Builder, T...>, T...
+        >;
+
+        template <typename Builder>
+        using builder_of = typename hana::detail::decay<Builder>::type;
+
+        template <std::size_t n, typename Builder>
+        using builder_element = typename hana::detail::decay<
+            decltype(detail::builder_get<n>(std::declval<Builder>()))
+        >::type;
+    }
+} // end namespace experimental
+
+//////////////////////////////////////////////////////////////////////////
+// make
+//////////////////////////////////////////////////////////////////////////
+template <>
+struct make_impl<experimental::tuple_builder_tag> {
+    template <typename ...Xs>
+    static constexpr auto apply(Xs&& ...xs) {
+        using Builder = experimental::detail::extended_builder<
+            experimental::tuple_builder<>,
+            typename detail::decay<Xs>::type...
+        >;
+        return Builder{experimental::detail::builder_extend{},
+                       experimental::tuple_builder<>{},
+                       static_cast<Xs&&>(xs)...};
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Foldable
+//////////////////////////////////////////////////////////////////////////
+template <>
+struct unpack_impl<experimental::tuple_builder_tag> {
+    template <typename Builder, typename F, std::size_t ...i>
+    static constexpr decltype(auto)
+    unpack_helper(Builder&& builder, F&& f, std::index_sequence<i...>) {
+        return static_cast<F&&>(f)(
+            experimental::detail::builder_get<i>(static_cast<Builder&&>(builder))...
+        );
+    }
+
+    template <typename Builder, typename F>
+    static constexpr decltype(auto) apply(Builder&& builder, F&& f) {
+        constexpr std::size_t N = experimental::detail::builder_of<Builder>::size_;
+        return unpack_helper(static_cast<Builder&&>(builder), static_cast<F&&>(f),
+                             std::make_index_sequence<N>{});
+    }
+};
+
+template <>
+struct length_impl<experimental::tuple_builder_tag> {
+    template <typename Builder>
+    static constexpr auto apply(Builder const&) {
+        return hana::size_c<Builder::size_>;
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////
+// MonadPlus
+//////////////////////////////////////////////////////////////////////////
+template <>
+struct empty_impl<experimental::tuple_builder_tag> {
+    static constexpr auto apply() {
+        return experimental::tuple_builder<>{};
+    }
+};
+
+template <>
+struct append_impl<experimental::tuple_builder_tag> {
+    template <typename Builder, typename X>
+    static constexpr auto apply(Builder&& builder, X&& x) {
+        using Result = experimental::detail::extended_builder<
+            experimental::detail::builder_of<Builder>,
+            typename detail::decay<X>::type
+        >;
+        return Result{experimental::detail::builder_extend{},
+                      static_cast<Builder&&>(builder), static_cast<X&&>(x)};
+    }
+};
+
+template <>
+struct concat_impl<experimental::tuple_builder_tag> {
+    template <typename Builder1, typename Builder2, std::size_t ...i>
+    static constexpr auto
+    concat_helper(Builder1&& b1, Builder2&& b2, std::index_sequence<i...>) {
+        using Result = experimental::detail::extended_builder<
+            experimental::detail::builder_of<Builder1>,
+            experimental::detail::builder_element<i, Builder2>...
+        >;
+        return Result{experimental::detail::builder_extend{},
+                      static_cast<Builder1&&>(b1),
+                      experimental::detail::builder_get<i>(static_cast<Builder2&&>(b2))...};
+    }
+
+    template <typename Builder1, typename Builder2>
+    static constexpr auto apply(Builder1&& b1, Builder2&& b2) {
+        constexpr std::size_t N = experimental::detail::builder_of<Builder2>::size_;
+        return concat_helper(static_cast<Builder1&&>(b1), static_cast<Builder2&&>(b2),
+                             std::make_index_sequence<N>{});
+    }
+};
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_TUPLE_BUILDER_HPP
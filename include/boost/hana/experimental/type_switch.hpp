@@ -0,0 +1,219 @@
+/*
+@file
+Defines `boost::hana::experimental::type_switch`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_TYPE_SWITCH_HPP
+#define BOOST_HANA_EXPERIMENTAL_TYPE_SWITCH_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/has_duplicates.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+#include <boost/hana/visit_at.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    namespace detail {
+        struct type_switch_entry {
+            std::size_t hash;
+            std::type_info const* type;
+            std::size_t index;
+        };
+
+        constexpr std::size_t type_switch_capacity(std::size_t n) {
+            std::size_t capacity = 1;
+            while (capacity < 2 * n)
+                capacity *= 2;
+            return capacity;
+        }
+
+        inline std::size_t type_switch_address_hash(char const* name) {
+            std::uint64_t h = reinterpret_cast<std::uintptr_t>(name);
+            return static_cast<std::size_t>((h * 0x9E3779B97F4A7C15ull) >> 32);
+        }
+
+        // Open-addressing hash tables mapping a `std::type_index` to the
+        // position of the matching case.
+        //
+        // The first table is keyed on the address of the name of the type,
+        // which is all that is needed to identify it when the `type_info`
+        // objects are unique, as they usually are. Since that is not always
+        // the case (e.g. across shared libraries), the second table is keyed
+        // on `std::type_index::hash_code`, which is more expensive to compute
+        // but always reliable, and is used when the first lookup fails.
+        template <std::size_t N>
+        struct type_switch_table {
+            static constexpr std::size_t capacity = type_switch_capacity(N);
+            static constexpr std::size_t mask = capacity - 1;
+            type_switch_entry by_address[capacity];
+            type_switch_entry by_hash[capacity];
+
+            static void insert(type_switch_entry (&entries)[capacity],
+                               type_switch_entry entry)
+            {
+                std::size_t slot = entry.hash & mask;
+                while (entries[slot].type != nullptr)
+                    slot = (slot + 1) & mask;
+                entries[slot] = entry;
+            }
+
+            explicit type_switch_table(std::type_info const* const (&types)[N])
+                : by_address{}, by_hash{}
+            {
+                for (std::size_t index = 0; index != N; ++index) {
+                    std::type_info const* type = types[index];
+                    insert(by_address, {type_switch_address_hash(type->name()), type, index});
+                    insert(by_hash, {type->hash_code(), type, index});
+                }
+            }
+
+            std::size_t find(std::type_index const& t) const {
+                char const* name = t.name();
+                for (std::size_t slot = type_switch_address_hash(name) & mask;
+                     by_address[slot].type != nullptr; slot = (slot + 1) & mask)
+                {
+                    if (by_address[slot].type->name() == name)
+                        return by_address[slot].index;
+                }
+
+                std::size_t hash = t.hash_code();
+                for (std::size_t slot = hash & mask;
+                     by_hash[slot].type != nullptr; slot = (slot + 1) & mask)
+                {
+                    if (by_hash[slot].hash == hash && std::type_index{*by_hash[slot].type} == t)
+                        return by_hash[slot].index;
+                }
+                return N;
+            }
+        };
+
+        template <typename Case>
+        using case_type = typename hana::detail::decay<
+            decltype(hana::first(std::declval<Case>()))
+        >::type;
+
+        template <typename Result, typename Get>
+        struct type_switch_visitor {
+            Get& get;
+
+            template <typename Case>
+            Result operator()(Case const& c) const {
+                using T = typename case_type<Case const&>::type;
+                return hana::second(c)(get(hana::type_c<T>));
+            }
+        };
+
+        template <typename ...Case>
+        class type_switch {
+            static constexpr std::size_t N = sizeof...(Case);
+
+            static_assert(N > 0,
+            "hana::experimental::type_switch(cases) requires at least one case");
+
+            static_assert(!hana::detail::has_duplicates<case_type<Case>...>::value,
+            "hana::experimental::type_switch(cases) requires the types of the cases to be unique");
+
+            hana::tuple<Case...> cases_;
+
+            static type_switch_table<N> const& table() {
+                static std::type_info const* const types[N] = {
+                    &typeid(typename case_type<Case>::type)...
+                };
+                static type_switch_table<N> const table_{types};
+                return table_;
+            }
+
+        public:
+            explicit constexpr type_switch(hana::tuple<Case...> cases)
+                : cases_(std::move(cases))
+            { }
+
+            //! Returns the number of cases, which is also the value returned
+            //! by `find` when no case matches.
+            static constexpr std::size_t size()
+            { return N; }
+
+            //! Returns the position of the case for the type `t`, or `size()`
+            //! if there is no such case.
+            static std::size_t find(std::type_index const& t)
+            { return table().find(t); }
+
+            //! Calls the handler of the case for the type `t` with
+            //! `get(hana::type_c<T>)`, where `T` is the type of that case.
+            //! If there is no case for `t`, `otherwise()` is called instead.
+            //! The result is the common type of the results of all the
+            //! handlers and of `otherwise`.
+            template <typename Get, typename Otherwise>
+            decltype(auto) operator()(std::type_index const& t, Get&& get,
+                                      Otherwise&& otherwise) const
+            {
+                using Result = typename std::common_type<
+                    decltype(hana::second(std::declval<Case const&>())(
+                        get(hana::type_c<typename case_type<Case>::type>)
+                    ))...,
+                    decltype(static_cast<Otherwise&&>(otherwise)())
+                >::type;
+
+                std::size_t index = find(t);
+                if (index == N)
+                    return static_cast<Result>(static_cast<Otherwise&&>(otherwise)());
+
+                return hana::visit_at(cases_, index,
+                    type_switch_visitor<Result, Get>{get});
+            }
+        };
+    }
+
+    //! @cond
+    struct type_switch_t {
+        template <typename ...Case>
+        constexpr detail::type_switch<Case...>
+        operator()(hana::tuple<Case...> cases) const
+        { return detail::type_switch<Case...>{std::move(cases)}; }
+    };
+    //! @endcond
+
+    //! @ingroup group-experimental
+    //! Creates an object dispatching on a `std::type_index` known only at
+    //! runtime.
+    //!
+    //! `type_switch` takes a `hana::tuple` of `hana::pair`s whose first
+    //! element is a `hana::type` and whose second element is the handler
+    //! for that type, and returns a function object `sw`. Calling
+    //! `sw(t, get, otherwise)` looks up the case whose type is `t`, and
+    //! calls its handler with `get(hana::type_c<T>)`, where `get` is used
+    //! to recover the object of type `T` from wherever it is stored (for
+    //! example a `boost::any`). If no case matches, `otherwise()` is called.
+    //!
+    //! The lookup goes through a hash table of the `std::type_info`s of the
+    //! cases, which is built the first time a switch with those cases is
+    //! used, and the handler is then called through `hana::visit_at`. Hence,
+    //! the cost of a dispatch does not grow with the number of cases, unlike
+    //! a chain of comparisons against `typeid(T)`.
+    //!
+    //! This requires RTTI to be enabled.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/type_switch.cpp
+    constexpr type_switch_t type_switch{};
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_TYPE_SWITCH_HPP
@@ -13,14 +13,38 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/bool.hpp>
 #include <boost/hana/concept/metafunction.hpp>
 #include <boost/hana/config.hpp>
+#include <boost/hana/detail/algorithm.hpp>
 #include <boost/hana/detail/any_of.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/index_if.hpp>
+#include <boost/hana/fwd/all_of.hpp>
+#include <boost/hana/fwd/any_of.hpp>
 #include <boost/hana/fwd/at.hpp>
+#include <boost/hana/fwd/concat.hpp>
+#include <boost/hana/fwd/concept/sequence.hpp>
 #include <boost/hana/fwd/contains.hpp>
+#include <boost/hana/fwd/core/make.hpp>
 #include <boost/hana/fwd/core/tag_of.hpp>
+#include <boost/hana/fwd/count_if.hpp>
+#include <boost/hana/fwd/drop_front.hpp>
+#include <boost/hana/fwd/empty.hpp>
 #include <boost/hana/fwd/equal.hpp>
+#include <boost/hana/fwd/filter.hpp>
+#include <boost/hana/fwd/find_if.hpp>
 #include <boost/hana/fwd/is_empty.hpp>
+#include <boost/hana/fwd/length.hpp>
+#include <boost/hana/fwd/none_of.hpp>
+#include <boost/hana/fwd/partition.hpp>
+#include <boost/hana/fwd/remove_if.hpp>
+#include <boost/hana/fwd/reverse.hpp>
 #include <boost/hana/fwd/transform.hpp>
+#include <boost/hana/fwd/unique.hpp>
 #include <boost/hana/fwd/unpack.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/sort.hpp>
 #include <boost/hana/type.hpp>
 
 #include <cstddef>
@@ -38,6 +62,30 @@ BOOST_HANA_NAMESPACE_BEGIN
         //! storing and manipulating pure types in a much more compile-time
         //! efficient manner than using `hana::tuple`, which must assume that
         //! its contents might have runtime values.
+        //!
+        //! `types` is a `Sequence` whose elements are the `hana::type`s of
+        //! its template arguments, and it can be created from such `type`s
+        //! with `hana::make<types_tag>`. The algorithms below are implemented
+        //! directly on the template arguments, without ever creating a `type`
+        //! object or instantiating the types themselves, which may hence be
+        //! incomplete: `unpack`, `length`, `count_if`, `transform`, `at`,
+        //! `drop_front`, `is_empty`, `contains`, `find_if`, `any_of`,
+        //! `all_of`, `none_of`, `filter`, `remove_if`, `partition`, `sort`,
+        //! `unique`, `reverse`, `concat`, `empty` and `equal`. Other
+        //! algorithms use the generic implementations provided for
+        //! `Sequence`s.
+        //!
+        //! The predicates given to these algorithms may either be functions
+        //! returning an `IntegralConstant` when called with `hana::type`s,
+        //! like `hana::trait<std::is_pointer>`, or `Metafunction`s returning
+        //! an integral constant, like `hana::metafunction<std::is_pointer>`.
+        //! The latter are evaluated as `F::apply<T...>::%type::%value`, which
+        //! does not instantiate anything but the metafunction itself.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @include example/experimental/types.cpp
         template <typename ...T>
         struct types;
 
@@ -54,6 +102,18 @@ BOOST_HANA_NAMESPACE_BEGIN
         using type = experimental::types_tag;
     };
 
+    template <>
+    struct Sequence<hana::experimental::types_tag> {
+        static constexpr bool value = true;
+    };
+
+    template <>
+    struct make_impl<hana::experimental::types_tag> {
+        template <typename ...T>
+        static constexpr hana::experimental::types<typename T::type...>
+        apply(T const& ...) { return {}; }
+    };
+
     // Foldable
     template <>
     struct unpack_impl<hana::experimental::types_tag> {
@@ -102,8 +162,95 @@ BOOST_HANA_NAMESPACE_BEGIN
 
         template <std::size_t I, typename T>
         elt<I, T> get_elt(elt<I, T> const&);
+
+        template <typename ...T>
+        using indexer_for = indexer<std::make_index_sequence<sizeof...(T)>, T...>;
+
+        template <std::size_t I, typename Indexer>
+        using elt_at = typename decltype(types_detail::get_elt<I>(Indexer{}))::type;
+
+        template <typename Indexer, std::size_t ...I>
+        hana::experimental::types<elt_at<I, Indexer>...>
+        select(std::index_sequence<I...>);
+
+        // Evaluates a predicate on types. `Metafunction`s are applied to
+        // the types directly, while other functions are called with
+        // `hana::type`s and must return an `IntegralConstant`.
+        template <typename Pred, bool = hana::Metafunction<Pred>::value>
+        struct predicate {
+            template <typename ...T>
+            using apply = std::integral_constant<bool, static_cast<bool>(
+                Pred::template apply<T...>::type::value
+            )>;
+        };
+
+        template <typename Pred>
+        struct predicate<Pred, false> {
+            template <typename ...T>
+            using apply = std::integral_constant<bool, static_cast<bool>(
+                hana::detail::decay<decltype(
+                    std::declval<Pred const&>()(hana::type<T>{}...)
+                )>::type::value
+            )>;
+        };
+
+        // Splits indices in those whose result is `true` and those whose
+        // result is `false`, keeping their relative order.
+        template <bool ...b>
+        struct split {
+            static constexpr bool results[] = {b..., false}; // avoid empty array
+            static constexpr std::size_t left_size =
+                hana::detail::count(results, results + sizeof...(b), true);
+            static constexpr std::size_t right_size = sizeof...(b) - left_size;
+
+            template <bool which, std::size_t N>
+            static constexpr auto compute() {
+                hana::detail::array<std::size_t, N> indices{};
+                std::size_t* out = &indices[0];
+                for (std::size_t i = 0; i < sizeof...(b); ++i)
+                    if (results[i] == which)
+                        *out++ = i;
+                return indices;
+            }
+
+            static constexpr auto left = compute<true, left_size>();
+            static constexpr auto right = compute<false, right_size>();
+
+            template <typename Indexer, std::size_t ...i>
+            static hana::experimental::types<elt_at<left[i], Indexer>...>
+            select_left(std::index_sequence<i...>);
+
+            template <typename Indexer, std::size_t ...i>
+            static hana::experimental::types<elt_at<right[i], Indexer>...>
+            select_right(std::index_sequence<i...>);
+        };
+
+        template <typename Pred, typename ...T>
+        using split_by = split<predicate<Pred>::template apply<T>::value...>;
+
+        template <typename Pred, typename ...T>
+        using first_satisfying = hana::detail::first_true<
+            predicate<Pred>::template apply<T>::value...
+        >;
     }
 
+    // Foldable
+    template <>
+    struct length_impl<hana::experimental::types_tag> {
+        template <typename ...T>
+        static constexpr hana::size_t<sizeof...(T)>
+        apply(hana::experimental::types<T...> const&)
+        { return {}; }
+    };
+
+    template <>
+    struct count_if_impl<hana::experimental::types_tag> {
+        template <typename ...T, typename Pred>
+        static constexpr auto apply(hana::experimental::types<T...> const&, Pred const&)
+            -> hana::size_t<types_detail::split_by<Pred, T...>::left_size>
+        { return {}; }
+    };
+
     // Iterable
     template <>
     struct at_impl<hana::experimental::types_tag> {
@@ -162,6 +309,174 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr hana::false_ apply(...) { return {}; }
     };
 
+    template <>
+    struct find_if_impl<hana::experimental::types_tag> {
+        template <typename Indexer, std::size_t index>
+        static constexpr auto helper(hana::true_)
+        { return hana::nothing; }
+
+        template <typename Indexer, std::size_t index>
+        static constexpr auto helper(hana::false_)
+        { return hana::just(hana::type<types_detail::elt_at<index, Indexer>>{}); }
+
+        template <typename ...T, typename Pred>
+        static constexpr auto apply(hana::experimental::types<T...> const&, Pred const&) {
+            constexpr std::size_t index = types_detail::first_satisfying<Pred, T...>::value;
+            return helper<types_detail::indexer_for<T...>, index>(
+                hana::bool_c<index == sizeof...(T)>
+            );
+        }
+    };
+
+    template <>
+    struct any_of_impl<hana::experimental::types_tag> {
+        template <typename ...T, typename Pred>
+        static constexpr auto apply(hana::experimental::types<T...> const&, Pred const&)
+            -> hana::bool_<
+                types_detail::first_satisfying<Pred, T...>::value != sizeof...(T)
+            >
+        { return {}; }
+    };
+
+    template <>
+    struct all_of_impl<hana::experimental::types_tag> {
+        template <typename ...T, typename Pred>
+        static constexpr auto apply(hana::experimental::types<T...> const&, Pred const&)
+            -> hana::bool_<
+                types_detail::split_by<Pred, T...>::right_size == 0
+            >
+        { return {}; }
+    };
+
+    template <>
+    struct none_of_impl<hana::experimental::types_tag> {
+        template <typename ...T, typename Pred>
+        static constexpr auto apply(hana::experimental::types<T...> const&, Pred const&)
+            -> hana::bool_<
+                types_detail::first_satisfying<Pred, T...>::value == sizeof...(T)
+            >
+        { return {}; }
+    };
+
+    // MonadPlus
+    template <>
+    struct concat_impl<hana::experimental::types_tag> {
+        template <typename ...T, typename ...U>
+        static constexpr hana::experimental::types<T..., U...>
+        apply(hana::experimental::types<T...> const&, hana::experimental::types<U...> const&)
+        { return {}; }
+    };
+
+    template <>
+    struct empty_impl<hana::experimental::types_tag> {
+        static constexpr hana::experimental::types<> apply()
+        { return {}; }
+    };
+
+    template <>
+    struct filter_impl<hana::experimental::types_tag> {
+        template <typename ...T, typename Pred>
+        static constexpr auto apply(hana::experimental::types<T...> const&, Pred const&) {
+            using Split = types_detail::split_by<Pred, T...>;
+            return decltype(Split::template select_left<types_detail::indexer_for<T...>>(
+                std::make_index_sequence<Split::left_size>{}
+            )){};
+        }
+    };
+
+    template <>
+    struct remove_if_impl<hana::experimental::types_tag> {
+        template <typename ...T, typename Pred>
+        static constexpr auto apply(hana::experimental::types<T...> const&, Pred const&) {
+            using Split = types_detail::split_by<Pred, T...>;
+            return decltype(Split::template select_right<types_detail::indexer_for<T...>>(
+                std::make_index_sequence<Split::right_size>{}
+            )){};
+        }
+    };
+
+    // Sequence
+    template <>
+    struct partition_impl<hana::experimental::types_tag> {
+        template <typename ...T, typename Pred>
+        static constexpr auto apply(hana::experimental::types<T...> const&, Pred const&) {
+            using Split = types_detail::split_by<Pred, T...>;
+            using Indexer = types_detail::indexer_for<T...>;
+            using Left = decltype(Split::template select_left<Indexer>(
+                std::make_index_sequence<Split::left_size>{}
+            ));
+            using Right = decltype(Split::template select_right<Indexer>(
+                std::make_index_sequence<Split::right_size>{}
+            ));
+            return hana::make_pair(Left{}, Right{});
+        }
+    };
+
+    template <>
+    struct reverse_impl<hana::experimental::types_tag> {
+        template <typename Indexer, std::size_t n, std::size_t ...i>
+        static hana::experimental::types<types_detail::elt_at<n - i - 1, Indexer>...>
+        helper(std::index_sequence<i...>);
+
+        template <typename ...T>
+        static constexpr auto apply(hana::experimental::types<T...> const&) {
+            return decltype(helper<types_detail::indexer_for<T...>, sizeof...(T)>(
+                std::index_sequence_for<T...>{}
+            )){};
+        }
+    };
+
+    template <>
+    struct sort_impl<hana::experimental::types_tag> {
+        template <typename Pred, typename Indexer>
+        struct sort_predicate {
+            template <std::size_t I, std::size_t J>
+            using apply = typename types_detail::predicate<Pred>::template apply<
+                types_detail::elt_at<I, Indexer>, types_detail::elt_at<J, Indexer>
+            >;
+        };
+
+        template <typename ...T, typename Pred>
+        static constexpr auto apply(hana::experimental::types<T...> const&, Pred const&) {
+            using Indexer = types_detail::indexer_for<T...>;
+            using Indices = typename hana::detail::sort_helper<
+                sort_predicate<Pred, Indexer>, std::index_sequence_for<T...>
+            >::type;
+            return decltype(types_detail::select<Indexer>(Indices{})){};
+        }
+    };
+
+    template <>
+    struct unique_impl<hana::experimental::types_tag> {
+        // An element is kept unless it is equivalent to the one before it.
+        template <typename Pred, typename Indexer, std::size_t ...i>
+        static types_detail::split<true, !types_detail::predicate<Pred>::template apply<
+            types_detail::elt_at<i, Indexer>, types_detail::elt_at<i + 1, Indexer>
+        >::value...> split_helper(std::index_sequence<i...>);
+
+        template <typename T, typename ...Ts, typename Pred>
+        static constexpr auto
+        apply(hana::experimental::types<T, Ts...> const&, Pred const&) {
+            using Indexer = types_detail::indexer_for<T, Ts...>;
+            using Split = decltype(split_helper<Pred, Indexer>(
+                std::index_sequence_for<Ts...>{}
+            ));
+            return decltype(Split::template select_left<Indexer>(
+                std::make_index_sequence<Split::left_size>{}
+            )){};
+        }
+
+        template <typename Pred>
+        static constexpr hana::experimental::types<>
+        apply(hana::experimental::types<> const&, Pred const&)
+        { return {}; }
+
+        template <typename ...T>
+        static constexpr auto apply(hana::experimental::types<T...> const& types) {
+            return unique_impl::apply(types, hana::metafunction<std::is_same>);
+        }
+    };
+
     // Comparable
     template <>
     struct equal_impl<hana::experimental::types_tag, hana::experimental::types_tag> {
@@ -12,9 +12,13 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/and.hpp>
 #include <boost/hana/at.hpp>
+#include <boost/hana/basic_tuple.hpp>
 #include <boost/hana/bool.hpp>
 #include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/filter.hpp>
 #include <boost/hana/fold_left.hpp>
+#include <boost/hana/for_each.hpp>
 #include <boost/hana/functional/compose.hpp>
 #include <boost/hana/fwd/ap.hpp>
 #include <boost/hana/fwd/concat.hpp>
@@ -34,6 +38,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/unpack.hpp>
 
 #include <cstddef>
+#include <memory>
+#include <new>
 #include <type_traits>
 #include <utility>
 
@@ -121,15 +127,45 @@ namespace experimental {
     //////////////////////////////////////////////////////////////////////////
     // filtered_view
     //////////////////////////////////////////////////////////////////////////
-#if 0
-    template <typename Sequence, typename Pred>
-    using filtered_view_t = sliced_view_t<Sequence, detail::filtered_indices<...>>;
+    namespace detail {
+        template <typename Sequence, typename Indices, std::size_t ...i>
+        constexpr sliced_view_t<Sequence, Indices::indices[i]...>
+        make_filtered_view(Sequence& sequence, std::index_sequence<i...>) {
+            return {sequence};
+        }
+    }
 
+    // The predicate must return a compile-time `Logical`, like for
+    // `hana::filter`, so the indices of the kept elements are known
+    // statically and the result is simply a `sliced_view`. The predicate
+    // is only called in an unevaluated context, so filtering a
+    // `transformed_view` does not evaluate the transformation.
     template <typename Sequence, typename Pred>
-    constexpr filtered_view_t<Sequence, Pred> filtered(Sequence& sequence, Pred&& pred) {
-        return {sequence};
+    constexpr auto filtered(Sequence& sequence, Pred const& pred) {
+        using Indices = decltype(hana::unpack(
+            sequence, hana::detail::make_filter_indices<Pred>{pred}
+        ));
+        return detail::make_filtered_view<Sequence, Indices>(
+            sequence, std::make_index_sequence<Indices::indices.size()>{}
+        );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // reversed_view
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <typename Sequence, std::size_t ...i>
+        constexpr sliced_view_t<Sequence, sizeof...(i) - 1 - i...>
+        make_reversed_view(Sequence& sequence, std::index_sequence<i...>) {
+            return {sequence};
+        }
+    }
+
+    template <typename Sequence>
+    constexpr auto reversed(Sequence& sequence) {
+        constexpr std::size_t N = decltype(hana::length(sequence))::value;
+        return detail::make_reversed_view(sequence, std::make_index_sequence<N>{});
     }
-#endif
 
     //////////////////////////////////////////////////////////////////////////
     // joined_view
@@ -194,6 +230,159 @@ namespace experimental {
             static constexpr bool value = true;
         };
     }
+
+    //////////////////////////////////////////////////////////////////////////
+    // zipped_view
+    //////////////////////////////////////////////////////////////////////////
+    // The `i`-th element of a `zipped_view` is a `hana::basic_tuple` holding
+    // the `i`-th elements of the zipped sequences as returned by `hana::at`.
+    // In particular, the elements of sequences held by reference are not
+    // copied; the tuple holds references to them.
+    template <typename ...Sequences>
+    struct zipped_view_t {
+        hana::basic_tuple<detail::view_storage<Sequences>...> sequences_;
+        using hana_tag = view_tag;
+    };
+
+    struct make_zipped_view_t {
+        template <typename Sequence, typename ...Sequences>
+        constexpr zipped_view_t<Sequence, Sequences...>
+        operator()(Sequence& s, Sequences& ...ss) const {
+            static_assert(hana::detail::fast_and<
+                (decltype(hana::length(s))::value ==
+                 decltype(hana::length(ss))::value)...
+            >::value,
+            "hana::experimental::zipped(sequences...) requires all the sequences to have the same length");
+            return {hana::basic_tuple<detail::view_storage<Sequence>,
+                                      detail::view_storage<Sequences>...>{s, ss...}};
+        }
+    };
+    constexpr make_zipped_view_t zipped{};
+
+    namespace detail {
+        template <typename ...Sequences>
+        struct is_view<zipped_view_t<Sequences...>> {
+            static constexpr bool value = true;
+        };
+
+        template <std::size_t i, typename View, std::size_t ...k>
+        constexpr hana::basic_tuple<
+            decltype(hana::at_c<i>(hana::at_c<k>(std::declval<View&>().sequences_)))...
+        >
+        zipped_at(View& view, std::index_sequence<k...>) {
+            return hana::basic_tuple<
+                decltype(hana::at_c<i>(hana::at_c<k>(view.sequences_)))...
+            >{hana::at_c<i>(hana::at_c<k>(view.sequences_))...};
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // memoized_transformed_view
+    //////////////////////////////////////////////////////////////////////////
+    // Like a `transformed_view`, except the function is called at most once
+    // for each element, the first time that element is accessed. The result
+    // is kept in a cache shared by all the copies of the view, which must
+    // therefore outlive the references to its elements. The cache is not
+    // synchronized, and the view can't be used in constant expressions.
+    namespace detail {
+        template <typename T>
+        struct memo_slot {
+            memo_slot() = default;
+            memo_slot(memo_slot const&) = delete;
+            memo_slot& operator=(memo_slot const&) = delete;
+
+            ~memo_slot() {
+                if (engaged_)
+                    get().~T();
+            }
+
+            T& get() { return *reinterpret_cast<T*>(&storage_); }
+
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type storage_;
+            bool engaged_ = false;
+        };
+
+        template <typename Sequence, typename F, std::size_t i>
+        using memoized_result = typename hana::detail::decay<decltype(
+            std::declval<F const&>()(
+                hana::at_c<i>(std::declval<view_storage<Sequence> const&>())
+            )
+        )>::type;
+
+        template <typename Sequence, typename F, typename Indices>
+        struct make_memo_cache;
+
+        template <typename Sequence, typename F, std::size_t ...i>
+        struct make_memo_cache<Sequence, F, std::index_sequence<i...>> {
+            using type = hana::basic_tuple<
+                memo_slot<memoized_result<Sequence, F, i>>...
+            >;
+        };
+
+        template <typename Sequence, typename F>
+        using memo_cache = typename make_memo_cache<Sequence, F,
+            std::make_index_sequence<decltype(
+                hana::length(std::declval<view_storage<Sequence> const&>())
+            )::value>
+        >::type;
+    }
+
+    template <typename Sequence, typename F>
+    struct memoized_transformed_view_t {
+        detail::view_storage<Sequence> sequence_;
+        F f_;
+        std::shared_ptr<detail::memo_cache<Sequence, F>> cache_;
+        using hana_tag = view_tag;
+
+        template <std::size_t i>
+        detail::memoized_result<Sequence, F, i>& get() const {
+            auto& slot = hana::at_c<i>(*cache_);
+            if (!slot.engaged_) {
+                using T = detail::memoized_result<Sequence, F, i>;
+                ::new (static_cast<void*>(&slot.storage_)) T(f_(hana::at_c<i>(sequence_)));
+                slot.engaged_ = true;
+            }
+            return slot.get();
+        }
+    };
+
+    template <typename Sequence, typename F>
+    memoized_transformed_view_t<Sequence, typename hana::detail::decay<F>::type>
+    memoized_transformed(Sequence& sequence, F&& f) {
+        using Cache = detail::memo_cache<Sequence, typename hana::detail::decay<F>::type>;
+        return {sequence, static_cast<F&&>(f), std::make_shared<Cache>()};
+    }
+
+    namespace detail {
+        template <typename Sequence, typename F>
+        struct is_view<memoized_transformed_view_t<Sequence, F>> {
+            static constexpr bool value = true;
+        };
+    }
+
+    namespace detail {
+        // Used to traverse views one element at a time, so that each element
+        // computed by a view is destroyed before the next one is computed.
+        template <typename View, typename F>
+        struct view_for_each {
+            View& view;
+            F& f;
+
+            template <typename I>
+            constexpr void operator()(I const& i) const
+            { (void)f(hana::at(view, i)); }
+        };
+
+        template <typename View, typename F>
+        struct view_fold_left {
+            View& view;
+            F& f;
+
+            template <typename State, typename I>
+            constexpr decltype(auto) operator()(State&& state, I const& i) const
+            { return f(static_cast<State&&>(state), hana::at(view, i)); }
+        };
+    }
 } // end namespace experimental
 
 //////////////////////////////////////////////////////////////////////////
@@ -248,6 +437,82 @@ struct unpack_impl<experimental::view_tag> {
     static constexpr decltype(auto) apply(experimental::empty_view_t, F&& f) {
         return static_cast<F&&>(f)();
     }
+
+    // zipped_view
+    template <typename View, typename F, std::size_t ...i, std::size_t ...k>
+    static constexpr decltype(auto)
+    unpack_zipped(View& view, F&& f, std::index_sequence<i...>,
+                                     std::index_sequence<k...> sequences)
+    {
+        (void)view; // Remove spurious unused variable warnings with GCC
+        (void)sequences;
+        return static_cast<F&&>(f)(
+            experimental::detail::zipped_at<i>(view, sequences)...
+        );
+    }
+
+    template <typename ...S, typename F>
+    static constexpr decltype(auto)
+    apply(experimental::zipped_view_t<S...> view, F&& f) {
+        constexpr auto N = decltype(hana::length(hana::at_c<0>(view.sequences_)))::value;
+        return unpack_zipped(view, static_cast<F&&>(f),
+                             std::make_index_sequence<N>{},
+                             std::make_index_sequence<sizeof...(S)>{});
+    }
+
+    // memoized_transformed_view
+    template <typename View, typename F, std::size_t ...i>
+    static decltype(auto)
+    unpack_memoized(View const& view, F&& f, std::index_sequence<i...>) {
+        (void)view; // Remove spurious unused variable warning with GCC
+        return static_cast<F&&>(f)(view.template get<i>()...);
+    }
+
+    template <typename Sequence, typename F, typename G>
+    static decltype(auto)
+    apply(experimental::memoized_transformed_view_t<Sequence, F> const& view, G&& g) {
+        constexpr auto N = decltype(hana::length(view.sequence_))::value;
+        return unpack_memoized(view, static_cast<G&&>(g), std::make_index_sequence<N>{});
+    }
+};
+
+// The elements of a view are accessed one at a time, so that an element
+// computed by a transformed view is destroyed before the next one is
+// computed, instead of computing all of them upfront like `hana::unpack`.
+// Chains of views are hence traversed in a single pass, and without
+// creating any intermediate sequence.
+template <>
+struct fold_left_impl<experimental::view_tag> {
+    // with state
+    template <typename View, typename S, typename F>
+    static constexpr decltype(auto) apply(View view, S&& s, F&& f) {
+        constexpr auto N = decltype(hana::length(view))::value;
+        return hana::fold_left(hana::range_c<std::size_t, 0, N>,
+            static_cast<S&&>(s),
+            experimental::detail::view_fold_left<View, F>{view, f}
+        );
+    }
+
+    // without state
+    template <typename View, typename F>
+    static constexpr decltype(auto) apply(View view, F&& f) {
+        constexpr auto N = decltype(hana::length(view))::value;
+        return hana::fold_left(hana::range_c<std::size_t, 1, N>,
+            hana::at_c<0>(view),
+            experimental::detail::view_fold_left<View, F>{view, f}
+        );
+    }
+};
+
+template <>
+struct for_each_impl<experimental::view_tag> {
+    template <typename View, typename F>
+    static constexpr void apply(View view, F&& f) {
+        constexpr auto N = decltype(hana::length(view))::value;
+        hana::for_each(hana::range_c<std::size_t, 0, N>,
+            experimental::detail::view_for_each<View, F>{view, f}
+        );
+    }
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -300,6 +565,21 @@ struct at_impl<experimental::view_tag> {
     // empty_view
     template <typename N>
     static constexpr decltype(auto) apply(experimental::empty_view_t, N const&) = delete;
+
+    // zipped_view
+    template <typename ...S, typename N>
+    static constexpr auto apply(experimental::zipped_view_t<S...> view, N const&) {
+        return experimental::detail::zipped_at<N::value>(
+            view, std::make_index_sequence<sizeof...(S)>{}
+        );
+    }
+
+    // memoized_transformed_view
+    template <typename Sequence, typename F, typename N>
+    static decltype(auto)
+    apply(experimental::memoized_transformed_view_t<Sequence, F> const& view, N const&) {
+        return view.template get<N::value>();
+    }
 };
 
 template <>
@@ -336,6 +616,19 @@ struct length_impl<experimental::view_tag> {
     static constexpr auto apply(experimental::empty_view_t) {
         return hana::size_c<0>;
     }
+
+    // zipped_view
+    template <typename ...S>
+    static constexpr auto apply(experimental::zipped_view_t<S...> const& view) {
+        return hana::length(hana::at_c<0>(view.sequences_));
+    }
+
+    // memoized_transformed_view
+    template <typename Sequence, typename F>
+    static constexpr auto
+    apply(experimental::memoized_transformed_view_t<Sequence, F> const& view) {
+        return hana::length(view.sequence_);
+    }
 };
 
 template <>
@@ -370,6 +663,19 @@ struct is_empty_impl<experimental::view_tag> {
     static constexpr auto apply(experimental::empty_view_t) {
         return hana::true_c;
     }
+
+    // zipped_view
+    template <typename ...S>
+    static constexpr auto apply(experimental::zipped_view_t<S...> const& view) {
+        return hana::is_empty(hana::at_c<0>(view.sequences_));
+    }
+
+    // memoized_transformed_view
+    template <typename Sequence, typename F>
+    static constexpr auto
+    apply(experimental::memoized_transformed_view_t<Sequence, F> const& view) {
+        return hana::is_empty(view.sequence_);
+    }
 };
 
 template <>
@@ -452,6 +758,14 @@ struct empty_impl<experimental::view_tag> {
     }
 };
 
+template <>
+struct filter_impl<experimental::view_tag> {
+    template <typename View, typename Pred>
+    static constexpr auto apply(View view, Pred const& pred) {
+        return experimental::filtered(view, pred);
+    }
+};
+
 //////////////////////////////////////////////////////////////////////////
 // Comparable
 //////////////////////////////////////////////////////////////////////////
@@ -17,6 +17,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/core/make.hpp>
 #include <boost/hana/fwd/core/tag_of.hpp>
 #include <boost/hana/fwd/drop_front.hpp>
+#include <boost/hana/fwd/unpack.hpp>
 #include <boost/hana/length.hpp>
 
 #include <boost/fusion/container/deque.hpp>
@@ -93,6 +94,14 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable (the rest is in detail/common.hpp)
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct unpack_impl<ext::boost::fusion::deque_tag>
+        : detail::unpack_fusion_sequence
+    { };
+
     //////////////////////////////////////////////////////////////////////////
     // Sequence
     //////////////////////////////////////////////////////////////////////////
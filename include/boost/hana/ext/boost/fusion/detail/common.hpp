@@ -22,8 +22,11 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/fusion/sequence/intrinsic/at.hpp>
 #include <boost/fusion/sequence/intrinsic/empty.hpp>
 #include <boost/fusion/sequence/intrinsic/size.hpp>
+#include <boost/fusion/sequence/intrinsic/value_at.hpp>
 
 #include <cstddef>
+#include <type_traits>
+#include <utility>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -67,6 +70,53 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    namespace detail {
+        // `fusion::at_c` always returns an lvalue reference, even for an
+        // rvalue sequence. This is the type with which the `i`-th element
+        // of `Xs` must be forwarded instead, which allows moving from the
+        // elements of an rvalue sequence unless they are references.
+        template <typename Xs, std::size_t i, bool = std::is_lvalue_reference<Xs>::value>
+        struct fusion_element {
+            using type = decltype(boost::fusion::at_c<i>(std::declval<Xs>()));
+        };
+
+        template <typename Xs, std::size_t i>
+        struct fusion_element<Xs, i, false> {
+            using Raw = typename std::remove_reference<Xs>::type;
+            using T = typename boost::fusion::result_of::value_at_c<
+                typename std::remove_cv<Raw>::type, i
+            >::type;
+            using type = typename std::conditional<std::is_const<Raw>::value,
+                T const&&, T&&
+            >::type;
+        };
+
+        // Implementation of `unpack` for the Fusion sequences with random
+        // access, which expands `fusion::at_c` directly over the indices
+        // instead of going through `hana::at_c` for each element.
+        struct unpack_fusion_sequence {
+            template <typename Xs, typename F, std::size_t ...i>
+            static constexpr decltype(auto)
+            unpack_helper(Xs&& xs, F&& f, std::index_sequence<i...>) {
+                return static_cast<F&&>(f)(
+                    static_cast<typename fusion_element<Xs&&, i>::type>(
+                        boost::fusion::at_c<i>(xs)
+                    )...
+                );
+            }
+
+            template <typename Xs, typename F>
+            static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+                using Raw = typename std::remove_cv<
+                    typename std::remove_reference<Xs>::type
+                >::type;
+                using Size = typename boost::fusion::result_of::size<Raw>::type;
+                return unpack_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                     std::make_index_sequence<Size::value>{});
+            }
+        };
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // Sequence
     //////////////////////////////////////////////////////////////////////////
@@ -18,6 +18,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/core/tag_of.hpp>
 #include <boost/hana/fwd/drop_front.hpp>
 #include <boost/hana/fwd/length.hpp>
+#include <boost/hana/fwd/unpack.hpp>
 
 #include <boost/fusion/algorithm/transformation/pop_front.hpp>
 #include <boost/fusion/container/generation/make_list.hpp>
@@ -96,6 +97,54 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable (the rest is in detail/common.hpp)
+    //
+    // Accessing an element of a Fusion list is linear in its index, so
+    // unpacking a list with `fusion::at_c` would be quadratic. Instead, we
+    // walk the underlying `cons` cells once, accumulating their elements.
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <typename Car, typename Cdr>
+        ::boost::fusion::cons<Car, Cdr>
+        fusion_cons_of(::boost::fusion::cons<Car, Cdr> const&);
+
+        ::boost::fusion::nil_ fusion_cons_of(::boost::fusion::nil_ const&);
+
+        template <typename Cons>
+        struct unpack_fusion_cons;
+
+        template <>
+        struct unpack_fusion_cons< ::boost::fusion::nil_> {
+            template <typename F, typename Nil, typename ...X>
+            static constexpr decltype(auto) apply(F&& f, Nil&&, X&& ...x)
+            { return static_cast<F&&>(f)(static_cast<X&&>(x)...); }
+        };
+
+        template <typename Car, typename Cdr>
+        struct unpack_fusion_cons< ::boost::fusion::cons<Car, Cdr>> {
+            template <typename F, typename Cons, typename ...X>
+            static constexpr decltype(auto) apply(F&& f, Cons&& cons, X&& ...x) {
+                return unpack_fusion_cons<Cdr>::apply(static_cast<F&&>(f),
+                    static_cast<Cons&&>(cons).cdr,
+                    static_cast<X&&>(x)...,
+                    static_cast<Cons&&>(cons).car
+                );
+            }
+        };
+    }
+
+    template <>
+    struct unpack_impl<ext::boost::fusion::list_tag> {
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            using Cons = decltype(detail::fusion_cons_of(xs));
+            return detail::unpack_fusion_cons<Cons>::apply(
+                static_cast<F&&>(f), static_cast<Xs&&>(xs)
+            );
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Sequence
     //////////////////////////////////////////////////////////////////////////
@@ -18,6 +18,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/core/tag_of.hpp>
 #include <boost/hana/fwd/drop_front.hpp>
 #include <boost/hana/fwd/length.hpp>
+#include <boost/hana/fwd/unpack.hpp>
 
 #include <boost/fusion/algorithm/transformation/pop_front.hpp>
 #include <boost/fusion/container/generation/make_vector.hpp>
@@ -95,6 +96,14 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable (the rest is in detail/common.hpp)
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct unpack_impl<ext::boost::fusion::vector_tag>
+        : detail::unpack_fusion_sequence
+    { };
+
     //////////////////////////////////////////////////////////////////////////
     // Sequence
     //////////////////////////////////////////////////////////////////////////
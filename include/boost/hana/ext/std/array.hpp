@@ -20,6 +20,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/is_empty.hpp>
 #include <boost/hana/fwd/length.hpp>
 #include <boost/hana/fwd/less.hpp>
+#include <boost/hana/fwd/unpack.hpp>
 #include <boost/hana/integral_constant.hpp>
 
 #include <array>
@@ -85,6 +86,26 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    template <>
+    struct unpack_impl<ext::std::array_tag> {
+        template <typename Xs, typename F, std::size_t ...i>
+        static constexpr decltype(auto)
+        unpack_helper(Xs&& xs, F&& f, std::index_sequence<i...>) {
+            return static_cast<F&&>(f)(std::get<i>(static_cast<Xs&&>(xs))...);
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            constexpr std::size_t N = std::tuple_size<
+                typename std::remove_cv<
+                    typename std::remove_reference<Xs>::type
+                >::type
+            >::value;
+            return unpack_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                 std::make_index_sequence<N>{});
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Iterable
     //////////////////////////////////////////////////////////////////////////
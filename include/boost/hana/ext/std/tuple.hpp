@@ -23,6 +23,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/is_empty.hpp>
 #include <boost/hana/fwd/length.hpp>
 #include <boost/hana/fwd/lift.hpp>
+#include <boost/hana/fwd/unpack.hpp>
 #include <boost/hana/integral_constant.hpp>
 
 #include <cstddef>
@@ -179,6 +180,31 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    // This is equivalent to the default implementation for Iterables, except
+    // it uses `std::get` directly instead of going through `hana::at_c` for
+    // each element. Since `transform` and `fold_left` are implemented with
+    // `unpack`, they benefit from it too.
+    template <>
+    struct unpack_impl<ext::std::tuple_tag> {
+        template <typename Xs, typename F, std::size_t ...i>
+        static constexpr decltype(auto)
+        unpack_helper(Xs&& xs, F&& f, std::index_sequence<i...>) {
+#if defined(BOOST_HANA_CONFIG_LIBCPP_HAS_BUG_22806)
+            return static_cast<F&&>(f)(std::get<i>(xs)...);
+#else
+            return static_cast<F&&>(f)(std::get<i>(static_cast<Xs&&>(xs))...);
+#endif
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            using Raw = typename std::remove_reference<Xs>::type;
+            constexpr std::size_t Length = std::tuple_size<Raw>::value;
+            return unpack_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                 std::make_index_sequence<Length>{});
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Sequence
     //////////////////////////////////////////////////////////////////////////
@@ -12,18 +12,70 @@ Distributed under the Boost Software License, Version 1.0.
 #define BOOST_HANA_EXT_STD_VECTOR_HPP
 
 #include <boost/hana/config.hpp>
+#include <boost/hana/detail/runtime_sequence.hpp>
 #include <boost/hana/equal.hpp>
+#include <boost/hana/fwd/any_of.hpp>
 #include <boost/hana/fwd/core/tag_of.hpp>
+#include <boost/hana/fwd/fold_left.hpp>
+#include <boost/hana/fwd/fold_right.hpp>
+#include <boost/hana/fwd/for_each.hpp>
+#include <boost/hana/fwd/transform.hpp>
 #include <boost/hana/less.hpp>
 
 #include <algorithm>
+#include <cstdio>
+#include <cstdlib>
 #include <iterator>
 #include <memory>
+#include <stdexcept>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#   define BOOST_HANA_EXT_STD_VECTOR_HAS_EXCEPTIONS
+#endif
+
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+namespace std {
+    //! @ingroup group-ext-std
+    //! Adaptation of `std::vector` for Hana.
+    //!
+    //!
+    //!
+    //! Modeled concepts
+    //! ----------------
+    //! 1. `Comparable`\n
+    //! `std::vector`s are compared as per `std::equal`, with the elements
+    //! compared with `hana::equal`.
+    //!
+    //! 2. `Orderable`\n
+    //! `std::vector`s are ordered lexicographically, with the elements
+    //! ordered with `hana::less`.
+    //!
+    //! 3. `Functor`\n
+    //! Transforming a `std::vector` returns a new `std::vector`. When an
+    //! rvalue vector is transformed by a function returning elements of the
+    //! same type, the vector is modified in place and returned.
+    //!
+    //!
+    //! Runtime algorithms
+    //! ------------------
+    //! The length of a `std::vector` is only known at runtime, so it is
+    //! neither `Foldable` nor `Searchable`. However, `fold_left`,
+    //! `fold_right`, `fold`, `reverse_fold`, `for_each`, `any_of`, `all_of`,
+    //! `none_of` and `contains` can be used with it. The state of a fold
+    //! must have the same type at each step, and the folds without an
+    //! initial state require the vector to be non-empty. This is checked
+    //! at runtime: a `std::invalid_argument` exception is thrown for an
+    //! empty vector, or the program is aborted if exceptions are disabled.
+    template <typename T, typename Allocator>
+    struct vector { };
+}
+#endif
+
+
 BOOST_HANA_NAMESPACE_BEGIN
     namespace ext { namespace std { struct vector_tag; }}
 
@@ -32,6 +84,11 @@ BOOST_HANA_NAMESPACE_BEGIN
         using type = ext::std::vector_tag;
     };
 
+    namespace detail {
+        template <>
+        struct runtime_sequence<ext::std::vector_tag> : std::true_type { };
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // Comparable
     //////////////////////////////////////////////////////////////////////////
@@ -62,7 +119,40 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
-#if 0
+    namespace detail {
+        // The folds without a state can't be applied to an empty vector.
+        // Since this is only known at runtime, it is reported by throwing
+        // an exception, or by aborting when exceptions are disabled.
+        template <typename V>
+        void check_vector_not_empty(V const& v, char const* message) {
+            if (!v.empty())
+                return;
+        #ifdef BOOST_HANA_EXT_STD_VECTOR_HAS_EXCEPTIONS
+            throw std::invalid_argument(message);
+        #else
+            std::fprintf(stderr, "%s\n", message);
+            std::abort();
+        #endif
+        }
+
+        // The type of the elements of a vector when it is accessed with the
+        // value category of `V`, so that the elements of an rvalue vector
+        // can be moved from. When the vector returns proxies instead of
+        // references, like `std::vector<bool>`, the elements of an lvalue
+        // vector are accessed through the proxy and those of an rvalue
+        // vector are accessed by value.
+        template <typename V, typename Reference = decltype(*std::declval<V>().begin())>
+        using vector_element_t = std::conditional_t<
+            std::is_lvalue_reference<V>::value,
+            Reference,
+            std::conditional_t<
+                std::is_reference<Reference>::value,
+                typename std::remove_reference_t<V>::value_type&&,
+                typename std::remove_reference_t<V>::value_type
+            >
+        >;
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // Functor
     //////////////////////////////////////////////////////////////////////////
@@ -70,16 +160,17 @@ BOOST_HANA_NAMESPACE_BEGIN
     struct transform_impl<ext::std::vector_tag> {
         template <typename V, typename F>
         static auto apply(V&& v, F&& f) {
+            using Element = detail::vector_element_t<V&&>;
             using U = std::remove_cv_t<std::remove_reference_t<
-                decltype(f(*v.begin()))
+                decltype(f(std::declval<Element>()))
             >>;
             using Alloc = typename std::remove_reference_t<V>::allocator_type;
             using NewAlloc = typename std::allocator_traits<Alloc>::
                              template rebind_alloc<U>;
-            std::vector<U, NewAlloc> result; result.reserve(v.size());
-
-            std::transform(begin(v), end(v),
-                           std::back_inserter(result), std::forward<F>(f));
+            std::vector<U, NewAlloc> result(NewAlloc(v.get_allocator()));
+            result.reserve(v.size());
+            for (auto&& x : v)
+                result.push_back(f(static_cast<Element>(x)));
             return result;
         }
 
@@ -89,7 +180,7 @@ BOOST_HANA_NAMESPACE_BEGIN
                 std::is_same<
                     T,
                     std::remove_cv_t<std::remove_reference_t<
-                        decltype(f(*v.begin()))
+                        decltype(f(std::move(*v.begin())))
                     >>
                 >{}
                 , std::vector<T, Alloc>
@@ -97,14 +188,117 @@ BOOST_HANA_NAMESPACE_BEGIN
         {
             // If we receive a rvalue and the function returns elements of
             // the same type, we modify the vector in-place instead of
-            // returning a new one.
-            std::transform(std::make_move_iterator(begin(v)),
-                           std::make_move_iterator(end(v)),
-                           begin(v), std::forward<F>(f));
+            // returning a new one, which reuses its storage.
+            for (auto&& x : v)
+                x = f(std::move(x));
             return std::move(v);
         }
     };
-#endif
+
+    //////////////////////////////////////////////////////////////////////////
+    // fold_left, fold_right and for_each
+    //
+    // The size of a vector is only known at runtime, so it is not Foldable;
+    // `unpack` and the algorithms returning an `IntegralConstant`, like
+    // `length`, can't be provided. Only these folds are, through
+    // `detail::runtime_sequence`, and the state of the fold must have the
+    // same type at each step.
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct fold_left_impl<ext::std::vector_tag> {
+        // with state
+        template <typename V, typename S, typename F>
+        static auto apply(V&& v, S&& s, F&& f) {
+            using Element = detail::vector_element_t<V&&>;
+            using State = std::decay_t<decltype(
+                f(static_cast<S&&>(s), std::declval<Element>())
+            )>;
+            State state(static_cast<S&&>(s));
+            for (auto&& x : v)
+                state = f(std::move(state), static_cast<Element>(x));
+            return state;
+        }
+
+        // without state; the vector must not be empty
+        template <typename V, typename F>
+        static auto apply(V&& v, F&& f) {
+            using Element = detail::vector_element_t<V&&>;
+            using State = std::decay_t<decltype(
+                f(std::declval<Element>(), std::declval<Element>())
+            )>;
+            detail::check_vector_not_empty(v,
+                "hana::fold_left(xs, f) requires 'xs' to be a non-empty std::vector");
+            auto first = v.begin(), last = v.end();
+            State state(static_cast<Element>(*first));
+            for (++first; first != last; ++first)
+                state = f(std::move(state), static_cast<Element>(*first));
+            return state;
+        }
+    };
+
+    template <>
+    struct fold_right_impl<ext::std::vector_tag> {
+        // with state
+        template <typename V, typename S, typename F>
+        static auto apply(V&& v, S&& s, F&& f) {
+            using Element = detail::vector_element_t<V&&>;
+            using State = std::decay_t<decltype(
+                f(std::declval<Element>(), static_cast<S&&>(s))
+            )>;
+            State state(static_cast<S&&>(s));
+            for (auto first = v.rbegin(), last = v.rend(); first != last; ++first)
+                state = f(static_cast<Element>(*first), std::move(state));
+            return state;
+        }
+
+        // without state; the vector must not be empty
+        template <typename V, typename F>
+        static auto apply(V&& v, F&& f) {
+            using Element = detail::vector_element_t<V&&>;
+            using State = std::decay_t<decltype(
+                f(std::declval<Element>(), std::declval<Element>())
+            )>;
+            detail::check_vector_not_empty(v,
+                "hana::fold_right(xs, f) requires 'xs' to be a non-empty std::vector");
+            auto first = v.rbegin(), last = v.rend();
+            State state(static_cast<Element>(*first));
+            for (++first; first != last; ++first)
+                state = f(static_cast<Element>(*first), std::move(state));
+            return state;
+        }
+    };
+
+    template <>
+    struct for_each_impl<ext::std::vector_tag> {
+        template <typename V, typename F>
+        static void apply(V&& v, F&& f) {
+            using Element = detail::vector_element_t<V&&>;
+            for (auto&& x : v)
+                f(static_cast<Element>(x));
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // any_of, all_of, none_of and contains
+    //
+    // Since the elements of a vector are only known at runtime, `find_if`
+    // can't return a `hana::optional`, which must know whether it contains
+    // a value at compile-time, so a vector is not Searchable. Only `any_of`
+    // and the algorithms based on it, `all_of`, `none_of` and `contains`,
+    // are provided through `detail::runtime_sequence`.
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct any_of_impl<ext::std::vector_tag> {
+        template <typename V, typename Pred>
+        static bool apply(V const& v, Pred&& pred) {
+            for (auto const& x : v)
+                if (pred(x))
+                    return true;
+            return false;
+        }
+    };
 BOOST_HANA_NAMESPACE_END
 
+#undef BOOST_HANA_EXT_STD_VECTOR_HAS_EXCEPTIONS
+
 #endif // !BOOST_HANA_EXT_STD_VECTOR_HPP
@@ -15,6 +15,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/concept/foldable.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/runtime_sequence.hpp>
 #include <boost/hana/detail/variadic/foldr1.hpp>
 #include <boost/hana/functional/partial.hpp>
 #include <boost/hana/fwd/unpack.hpp>
@@ -26,11 +27,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr decltype(auto) fold_right_t::operator()(Xs&& xs, State&& state, F&& f) const {
         using S = typename hana::tag_of<Xs>::type;
         using FoldRight = BOOST_HANA_DISPATCH_IF(fold_right_impl<S>,
-            hana::Foldable<S>::value
+            hana::Foldable<S>::value || detail::runtime_sequence<S>::value
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Foldable<S>::value,
+        static_assert(hana::Foldable<S>::value || detail::runtime_sequence<S>::value,
         "hana::fold_right(xs, state, f) requires 'xs' to be Foldable");
     #endif
 
@@ -43,11 +44,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr decltype(auto) fold_right_t::operator()(Xs&& xs, F&& f) const {
         using S = typename hana::tag_of<Xs>::type;
         using FoldRight = BOOST_HANA_DISPATCH_IF(fold_right_impl<S>,
-            hana::Foldable<S>::value
+            hana::Foldable<S>::value || detail::runtime_sequence<S>::value
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Foldable<S>::value,
+        static_assert(hana::Foldable<S>::value || detail::runtime_sequence<S>::value,
         "hana::fold_right(xs, f) requires 'xs' to be Foldable");
     #endif
 
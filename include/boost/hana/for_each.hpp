@@ -15,6 +15,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/concept/foldable.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/runtime_sequence.hpp>
 #include <boost/hana/unpack.hpp>
 
 
@@ -24,11 +25,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr void for_each_t::operator()(Xs&& xs, F&& f) const {
         using S = typename hana::tag_of<Xs>::type;
         using ForEach = BOOST_HANA_DISPATCH_IF(for_each_impl<S>,
-            hana::Foldable<S>::value
+            hana::Foldable<S>::value || detail::runtime_sequence<S>::value
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Foldable<S>::value,
+        static_assert(hana::Foldable<S>::value || detail::runtime_sequence<S>::value,
         "hana::for_each(xs, f) requires 'xs' to be Foldable");
     #endif
 
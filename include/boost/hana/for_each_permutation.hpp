@@ -0,0 +1,74 @@
+/*!
+@file
+Defines `boost::hana::for_each_permutation`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FOR_EACH_PERMUTATION_HPP
+#define BOOST_HANA_FOR_EACH_PERMUTATION_HPP
+
+#include <boost/hana/fwd/for_each_permutation.hpp>
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/concept/sequence.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/nth_permutation.hpp>
+
+#include <cstddef>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! @cond
+    template <typename Xs, typename F>
+    constexpr void for_each_permutation_t::operator()(Xs&& xs, F&& f) const {
+        using S = typename hana::tag_of<Xs>::type;
+        using ForEachPermutation = BOOST_HANA_DISPATCH_IF(for_each_permutation_impl<S>,
+            hana::Sequence<S>::value
+        );
+
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(hana::Sequence<S>::value,
+        "hana::for_each_permutation(xs, f) requires 'xs' to be a Sequence");
+    #endif
+
+        return ForEachPermutation::apply(static_cast<Xs&&>(xs), static_cast<F&&>(f));
+    }
+    //! @endcond
+
+    template <typename S, bool condition>
+    struct for_each_permutation_impl<S, when<condition>> : default_ {
+        template <typename ...Args>
+        static constexpr void apply(Args&& ...) = delete;
+    };
+
+    template <typename S>
+    struct for_each_permutation_impl<S, when<Sequence<S>::value>> {
+        template <std::size_t n, typename Xs, typename F, std::size_t ...i>
+        static constexpr void call(Xs& xs, F& f, std::index_sequence<i...>) {
+            constexpr auto indices = detail::nth_permutation_indices<sizeof...(i)>(n);
+            (void)indices; // workaround GCC warning when sizeof...(i) == 0
+            (void)f(hana::at_c<indices[i]>(xs)...);
+        }
+
+        template <std::size_t N, typename Xs, typename F, std::size_t ...n>
+        static constexpr void call_all(Xs& xs, F& f, std::index_sequence<n...>) {
+            using Swallow = int[];
+            (void)Swallow{0, ((void)call<n>(xs, f, std::make_index_sequence<N>{}), 0)...};
+        }
+
+        template <typename Xs, typename F>
+        static constexpr void apply(Xs&& xs, F&& f) {
+            constexpr std::size_t N = decltype(hana::length(xs))::value;
+            call_all<N>(xs, f, std::make_index_sequence<detail::factorial(N)>{});
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FOR_EACH_PERMUTATION_HPP
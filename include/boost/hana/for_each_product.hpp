@@ -0,0 +1,100 @@
+/*!
+@file
+Defines `boost::hana::for_each_product`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FOR_EACH_PRODUCT_HPP
+#define BOOST_HANA_FOR_EACH_PRODUCT_HPP
+
+#include <boost/hana/fwd/for_each_product.hpp>
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/cartesian_product.hpp>
+#include <boost/hana/concept/foldable.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! @cond
+    template <typename Xs, typename F>
+    constexpr void for_each_product_t::operator()(Xs&& xs, F&& f) const {
+        using S = typename hana::tag_of<Xs>::type;
+        using ForEachProduct = BOOST_HANA_DISPATCH_IF(for_each_product_impl<S>,
+            hana::Foldable<S>::value
+        );
+
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(hana::Foldable<S>::value,
+        "hana::for_each_product(xs, f) requires 'xs' to be Foldable");
+    #endif
+
+        return ForEachProduct::apply(static_cast<Xs&&>(xs), static_cast<F&&>(f));
+    }
+    //! @endcond
+
+    template <typename S, bool condition>
+    struct for_each_product_impl<S, when<condition>> : default_ {
+        template <typename ...Args>
+        static constexpr void apply(Args&& ...) = delete;
+    };
+
+    namespace detail {
+        template <typename F>
+        struct on_each_combination {
+            F* f;
+
+            template <typename Indices, std::size_t n, std::size_t ...k, typename ...Ys>
+            static constexpr void call(F* f, std::index_sequence<k...>, Ys& ...ys) {
+                constexpr auto indices = Indices::indices_of(n);
+                (void)(*f)(hana::at_c<indices[k]>(ys)...);
+            }
+
+            template <typename Indices, std::size_t ...n, typename ...Ys>
+            static constexpr void
+            call_all(F* f, std::index_sequence<n...>, Ys& ...ys) {
+                using Swallow = int[];
+                (void)Swallow{0, ((void)on_each_combination::call<Indices, n>(
+                    f, std::index_sequence_for<Ys...>{}, ys...
+                ), 0)...};
+                (void)f; // Remove spurious unused variable warning with GCC
+            }
+
+            template <typename ...Ys>
+            constexpr void operator()(Ys&& ...ys) const {
+                using Indices = detail::cartesian_product_indices<
+                    decltype(hana::length(ys))::value...
+                >;
+                on_each_combination::call_all<Indices>(
+                    f, std::make_index_sequence<Indices::length>{}, ys...
+                );
+            }
+
+            constexpr void operator()() const { }
+        };
+    }
+
+    template <typename S>
+    struct for_each_product_impl<S, when<hana::Foldable<S>::value>> {
+        template <typename Xs, typename F>
+        static constexpr void apply(Xs&& xs, F&& f) {
+            // We use a pointer instead of a reference to avoid a Clang ICE.
+            hana::unpack(static_cast<Xs&&>(xs),
+                         detail::on_each_combination<
+                            typename std::remove_reference<F>::type
+                         >{&f});
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FOR_EACH_PRODUCT_HPP
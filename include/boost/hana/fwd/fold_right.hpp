@@ -37,6 +37,10 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! stucture contains a single element and the no-state version of the
     //! function was used, that single element is returned as is.
     //!
+    //! With a `std::vector`, whose emptiness is only known at runtime, the
+    //! no-state version throws a `std::invalid_argument` exception when the
+    //! vector is empty, or aborts the program if exceptions are disabled.
+    //!
     //!
     //! Signature
     //! ---------
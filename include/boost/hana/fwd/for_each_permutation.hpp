@@ -0,0 +1,78 @@
+/*!
+@file
+Forward declares `boost::hana::for_each_permutation`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_FOR_EACH_PERMUTATION_HPP
+#define BOOST_HANA_FWD_FOR_EACH_PERMUTATION_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/when.hpp>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! Calls a function on each permutation of a sequence, without
+    //! creating the permutations.
+    //! @ingroup group-Sequence
+    //!
+    //! Given a sequence `xs` of length `N`, `for_each_permutation(xs, f)`
+    //! calls `f(y1, ..., yN)` once for each of the `N!` permutations
+    //! `[y1, ..., yN]` of the elements of `xs`, in the same order as the
+    //! one of `nth_permutation`. This is equivalent to
+    //! @code
+    //!     for_each(permutations(xs), fuse(f))
+    //! @endcode
+    //! except that `f` is called with references to the elements of `xs`,
+    //! and that neither the permutations nor the sequence holding them are
+    //! ever created. Only the indices making up each permutation are
+    //! computed, at compile-time. This saves the instantiation of a
+    //! sequence for each permutation, and of the `N!`-element sequence
+    //! holding them.
+    //!
+    //! Since each element appears in every permutation, the elements are
+    //! never moved from, even when `xs` is an rvalue. The return value of
+    //! `f` is ignored. The empty sequence has a single permutation, so
+    //! `f()` is called exactly once when `xs` is empty.
+    //!
+    //!
+    //! @param xs
+    //! The sequence whose permutations are traversed.
+    //!
+    //! @param f
+    //! A function called as `f(y1, ..., yN)` for each permutation of the
+    //! elements of `xs`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/for_each_permutation.cpp
+    //!
+    //!
+    //! Benchmarks
+    //! ----------
+    //! <div class="benchmark-chart"
+    //!      style="min-width: 310px; height: 400px; margin: 0 auto"
+    //!      data-dataset="benchmark.permutations.compile.json">
+    //! </div>
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto for_each_permutation = [](auto&& xs, auto&& f) -> void {
+        tag-dispatched;
+    };
+#else
+    template <typename S, typename = void>
+    struct for_each_permutation_impl : for_each_permutation_impl<S, when<true>> { };
+
+    struct for_each_permutation_t {
+        template <typename Xs, typename F>
+        constexpr void operator()(Xs&& xs, F&& f) const;
+    };
+
+    constexpr for_each_permutation_t for_each_permutation{};
+#endif
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FWD_FOR_EACH_PERMUTATION_HPP
@@ -0,0 +1,80 @@
+/*!
+@file
+Forward declares `boost::hana::for_each_product`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_FOR_EACH_PRODUCT_HPP
+#define BOOST_HANA_FWD_FOR_EACH_PRODUCT_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/when.hpp>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! Calls a function on each combination of elements of the cartesian
+    //! product of sequences, without creating the product.
+    //! @ingroup group-Foldable
+    //!
+    //! Given a `Foldable` `xs` of `Iterable`s, `for_each_product(xs, f)`
+    //! calls `f(y1, ..., yn)` for every combination of elements `y1`, ...,
+    //! `yn` taken respectively from the first, ..., n-th `Iterable`, in
+    //! the same order as the one of `cartesian_product(xs)`. This is
+    //! equivalent to
+    //! @code
+    //!     for_each(cartesian_product(xs), fuse(f))
+    //! @endcode
+    //! except that `f` is called with references to the elements of the
+    //! original sequences, and that neither the combinations nor the
+    //! product itself are ever created. Only the indices of the elements
+    //! making up each combination are computed, at compile-time. When
+    //! the product is only traversed, this saves the instantiation of a
+    //! sequence for each combination, and of the very large type of the
+    //! product.
+    //!
+    //! Since each element appears in several combinations, the elements are
+    //! never moved from, even when `xs` is an rvalue. The return value of
+    //! `f` is ignored. Like `cartesian_product`, no combination is visited
+    //! when `xs` is empty, or when any of the sequences is empty.
+    //!
+    //!
+    //! @param xs
+    //! A `Foldable` of `Iterable`s whose cartesian product is traversed.
+    //!
+    //! @param f
+    //! A function called as `f(y1, ..., yn)` for each combination of
+    //! elements of the sequences.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/for_each_product.cpp
+    //!
+    //!
+    //! Benchmarks
+    //! ----------
+    //! <div class="benchmark-chart"
+    //!      style="min-width: 310px; height: 400px; margin: 0 auto"
+    //!      data-dataset="benchmark.cartesian_product.compile.json">
+    //! </div>
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto for_each_product = [](auto&& xs, auto&& f) -> void {
+        tag-dispatched;
+    };
+#else
+    template <typename S, typename = void>
+    struct for_each_product_impl : for_each_product_impl<S, when<true>> { };
+
+    struct for_each_product_t {
+        template <typename Xs, typename F>
+        constexpr void operator()(Xs&& xs, F&& f) const;
+    };
+
+    constexpr for_each_product_t for_each_product{};
+#endif
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FWD_FOR_EACH_PRODUCT_HPP
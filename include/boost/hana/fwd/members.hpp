@@ -1,6 +1,7 @@
 /*!
 @file
-Forward declares `boost::hana::members`.
+Forward declares `boost::hana::members`, `boost::hana::unpack_members`
+and `boost::hana::for_each_member`.
 
 @copyright Louis Dionne 2013-2016
 Distributed under the Boost Software License, Version 1.0.
@@ -41,6 +42,65 @@ BOOST_HANA_NAMESPACE_BEGIN
 
     constexpr members_t members{};
 #endif
+
+    //! Calls a function with the members of a `Struct`, without copying them.
+    //! @ingroup group-Struct
+    //!
+    //! Given a `Struct` object and a function `f`, `unpack_members` calls
+    //! `f` with all the members of the object, in the same order as their
+    //! respective accessor appears in the `accessors` sequence. Unlike
+    //! `hana::unpack(hana::members(object), f)`, the members are passed to
+    //! `f` directly, with the value category of `object`: they are lvalues
+    //! (to const, when `object` is const) when `object` is an lvalue, and
+    //! rvalues when `object` is an rvalue. In particular, no copy of the
+    //! members is ever made.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/unpack_members.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto unpack_members = [](auto&& object, auto&& f) -> decltype(auto) {
+        return forwarded(f)(forwarded(members of object)...);
+    };
+#else
+    struct unpack_members_t {
+        template <typename Object, typename F>
+        constexpr decltype(auto) operator()(Object&& object, F&& f) const;
+    };
+
+    constexpr unpack_members_t unpack_members{};
+#endif
+
+    //! Calls a function with the name and the value of each member of a
+    //! `Struct`, without copying them.
+    //! @ingroup group-Struct
+    //!
+    //! Given a `Struct` object and a function `f`, `for_each_member` calls
+    //! `f(name, member)` for each member of the object, in the same order
+    //! as their respective accessor appears in the `accessors` sequence.
+    //! `name` is the key of the member, i.e. the first element of the pair
+    //! returned by `accessors`, and `member` is passed with the value
+    //! category of `object`, as for `unpack_members`. Unlike iterating
+    //! over the `Struct` with `hana::for_each`, this does not create a
+    //! `hana::pair` holding a copy of each member.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/for_each_member.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto for_each_member = [](auto&& object, auto&& f) -> void {
+        (f(name of member, forwarded(member)), ...);
+    };
+#else
+    struct for_each_member_t {
+        template <typename Object, typename F>
+        constexpr void operator()(Object&& object, F&& f) const;
+    };
+
+    constexpr for_each_member_t for_each_member{};
+#endif
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_FWD_MEMBERS_HPP
@@ -0,0 +1,85 @@
+/*!
+@file
+Forward declares `boost::hana::nth_permutation` and
+`boost::hana::nth_permutation_c`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_NTH_PERMUTATION_HPP
+#define BOOST_HANA_FWD_NTH_PERMUTATION_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/when.hpp>
+
+#include <cstddef>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! Returns the `n`-th permutation of a sequence, without computing
+    //! the other ones.
+    //! @ingroup group-Sequence
+    //!
+    //! The permutations of a sequence `xs` of length `N` are numbered from
+    //! `0` to `N! - 1` in the lexicographical order of the indices of their
+    //! elements in `xs`. For example, the permutations of `[x, y, z]` are
+    //! `[x, y, z]`, `[x, z, y]`, `[y, x, z]`, `[y, z, x]`, `[z, x, y]` and
+    //! `[z, y, x]`, in that order. This is also the order in which they
+    //! are returned by `permutations`, which is however unspecified.
+    //!
+    //! The indices of the `n`-th permutation are decoded from the
+    //! representation of `n` in the factorial number system, at
+    //! compile-time and in `O(N^2)` steps. Unlike `permutations(xs)`, which
+    //! creates all the `N!` permutations at once, this only ever creates
+    //! the requested one. The elements of `xs` are moved into the result
+    //! if `xs` is an rvalue.
+    //!
+    //!
+    //! @param xs
+    //! The sequence to permute.
+    //!
+    //! @param n
+    //! A non-negative `IntegralConstant` strictly smaller than the number
+    //! of permutations of `xs`, i.e. `length(xs)!`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/nth_permutation.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto nth_permutation = [](auto&& xs, auto const& n) {
+        return tag-dispatched;
+    };
+#else
+    template <typename S, typename = void>
+    struct nth_permutation_impl : nth_permutation_impl<S, when<true>> { };
+
+    struct nth_permutation_t {
+        template <typename Xs, typename N>
+        constexpr auto operator()(Xs&& xs, N const& n) const;
+    };
+
+    constexpr nth_permutation_t nth_permutation{};
+#endif
+
+    //! Equivalent to `nth_permutation`; provided for convenience.
+    //! @ingroup group-Sequence
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/nth_permutation.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <std::size_t n>
+    constexpr auto nth_permutation_c = [](auto&& xs) {
+        return hana::nth_permutation(forwarded(xs), hana::size_c<n>);
+    };
+#else
+    template <std::size_t n, typename Xs>
+    constexpr auto nth_permutation_c(Xs&& xs);
+#endif
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FWD_NTH_PERMUTATION_HPP
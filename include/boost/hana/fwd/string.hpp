@@ -29,9 +29,10 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! `hana::map` or tagging the members of a `Struct`. However, you might
     //! find that `hana::string` does not provide enough functionality to be
     //! used as a full-blown compile-time string implementation (e.g. regexp
-    //! matching or substring finding). Indeed, providing a comprehensive
-    //! string interface is a lot of job, and it is out of the scope of the
-    //! library for the time being.
+    //! matching). Indeed, providing a comprehensive string interface is a
+    //! lot of job, and it is out of the scope of the library for the time
+    //! being. Only a few basic operations like `find_substring`, `split`,
+    //! `replace_substring` and `join` are provided.
     //!
     //!
     //! @note
@@ -199,6 +200,160 @@ BOOST_HANA_NAMESPACE_BEGIN
     // defined in <boost/hana/string.hpp>
 #endif
 
+    //! Returns the position of the first occurrence of a substring in a
+    //! compile-time string.
+    //! @relates hana::string
+    //!
+    //! Given two `hana::string`s `str` and `sub`, `find_substring` returns
+    //! `just(size_c<i>)`, where `i` is the position of the first occurrence
+    //! of `sub` in `str`, or `nothing` if `sub` does not appear in `str`.
+    //! An empty `sub` is found at position `0`. The search is done with
+    //! the Knuth-Morris-Pratt algorithm inside a `constexpr` function, so
+    //! it requires a number of steps linear in the length of the strings,
+    //! and not recursive template instantiations.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/string/find_substring.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto find_substring = [](auto const& str, auto const& sub) {
+        return see-documentation;
+    };
+#else
+    struct find_substring_t {
+        template <char ...s, char ...sub>
+        constexpr auto operator()(string<s...> const&, string<sub...> const&) const;
+    };
+
+    constexpr find_substring_t find_substring{};
+#endif
+
+    //! Returns whether a compile-time string starts with the given prefix.
+    //! @relates hana::string
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/string/starts_with.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto starts_with = [](auto const& str, auto const& prefix) {
+        return see-documentation;
+    };
+#else
+    struct starts_with_t {
+        template <char ...s, char ...prefix>
+        constexpr auto operator()(string<s...> const&, string<prefix...> const&) const;
+    };
+
+    constexpr starts_with_t starts_with{};
+#endif
+
+    //! Returns whether a compile-time string ends with the given suffix.
+    //! @relates hana::string
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/string/ends_with.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto ends_with = [](auto const& str, auto const& suffix) {
+        return see-documentation;
+    };
+#else
+    struct ends_with_t {
+        template <char ...s, char ...suffix>
+        constexpr auto operator()(string<s...> const&, string<suffix...> const&) const;
+    };
+
+    constexpr ends_with_t ends_with{};
+#endif
+
+    //! Splits a compile-time string at each occurrence of a character.
+    //! @relates hana::string
+    //!
+    //! Given a `hana::string` and a `Constant` character `c`, `split`
+    //! returns a `hana::tuple` of the `hana::string`s delimited by the
+    //! occurrences of `c`. Consecutive occurrences of `c` delimit empty
+    //! strings, and splitting a string which does not contain `c` returns
+    //! a tuple holding that string only. Hence, the result always contains
+    //! one more string than there are occurrences of `c`, and `join`ing it
+    //! with `c` gives back the original string.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/string/split.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto split = [](auto const& str, auto const& c) {
+        return see-documentation;
+    };
+#else
+    struct split_t {
+        template <char ...s, typename Char>
+        constexpr auto operator()(string<s...> const&, Char const&) const;
+    };
+
+    constexpr split_t split{};
+#endif
+
+    //! Replaces every occurrence of a substring in a compile-time string.
+    //! @relates hana::string
+    //!
+    //! Given three `hana::string`s `str`, `oldsub` and `newsub`,
+    //! `replace_substring` returns a `hana::string` in which every
+    //! occurrence of `oldsub` in `str` is replaced by `newsub`. The
+    //! occurrences are found from left to right and they are not allowed
+    //! to overlap. `oldsub` must not be empty.
+    //!
+    //! @note
+    //! This is not called `replace` because `hana::replace` is already the
+    //! `Functor` algorithm replacing single elements of a structure.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/string/replace_substring.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto replace_substring = [](auto const& str, auto const& oldsub, auto const& newsub) {
+        return see-documentation;
+    };
+#else
+    struct replace_substring_t {
+        template <char ...s, char ...oldsub, char ...newsub>
+        constexpr auto operator()(string<s...> const&, string<oldsub...> const&,
+                                  string<newsub...> const&) const;
+    };
+
+    constexpr replace_substring_t replace_substring{};
+#endif
+
+    //! Concatenates compile-time strings, inserting a separator between
+    //! each of them.
+    //! @relates hana::string
+    //!
+    //! Given a `Foldable` structure `xs` containing `hana::string`s and a
+    //! separator `sep`, `join` returns a `hana::string` made of the strings
+    //! in `xs` separated by `sep`. The separator may either be a
+    //! `hana::string` or a `Constant` character.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/string/join.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto join = [](auto&& xs, auto const& sep) {
+        return see-documentation;
+    };
+#else
+    struct join_t {
+        template <typename Xs, typename Separator>
+        constexpr auto operator()(Xs&& xs, Separator const& sep) const;
+    };
+
+    constexpr join_t join{};
+#endif
+
 #ifdef BOOST_HANA_CONFIG_ENABLE_STRING_UDL
     namespace literals {
         //! Creates a compile-time string from a string literal.
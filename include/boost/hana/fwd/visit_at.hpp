@@ -0,0 +1,72 @@
+/*!
+@file
+Forward declares `boost::hana::visit_at`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_VISIT_AT_HPP
+#define BOOST_HANA_FWD_VISIT_AT_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/when.hpp>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! Calls a function on the element of an iterable selected by an
+    //! index only known at runtime.
+    //! @ingroup group-Iterable
+    //!
+    //! Given an `Iterable` `xs` with a linearization of `[x0, ..., xN-1]`,
+    //! a runtime index `n` and a function `f`, `visit_at(xs, n, f)` is
+    //! equivalent to `f(xn)`. Since the element to visit is only known at
+    //! runtime, `f` must be callable with every element of the iterable,
+    //! and it must return the same type for all of them.
+    //!
+    //! Unlike the usual idiom of calling `for_each` and comparing each
+    //! index with `n`, `visit_at` jumps directly to the right element
+    //! through a table of function pointers, so its runtime cost does not
+    //! depend on the number of elements.
+    //!
+    //! `visit_at` is also provided for `hana::map`, in which case the
+    //! values of the map are visited, in the same order as they would be
+    //! returned by `hana::keys`.
+    //!
+    //!
+    //! @param xs
+    //! The non-empty iterable in which an element is visited.
+    //!
+    //! @param n
+    //! A value convertible to `std::size_t` representing the 0-based index
+    //! of the element to visit. `n` must be strictly less than the length
+    //! of `xs`; calling `visit_at` with an index that is out of bounds is
+    //! undefined behavior.
+    //!
+    //! @param f
+    //! A function called as `f(xn)`. The result of `visit_at` is the result
+    //! of `f(x0)`, to which the result of `f(xn)` is converted.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/visit_at.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto visit_at = [](auto&& xs, auto const& n, auto&& f) -> decltype(auto) {
+        return tag-dispatched;
+    };
+#else
+    template <typename S, typename = void>
+    struct visit_at_impl : visit_at_impl<S, when<true>> { };
+
+    struct visit_at_t {
+        template <typename Xs, typename N, typename F>
+        constexpr decltype(auto) operator()(Xs&& xs, N const& n, F&& f) const;
+    };
+
+    constexpr visit_at_t visit_at{};
+#endif
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FWD_VISIT_AT_HPP
@@ -19,6 +19,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/first.hpp>
 #include <boost/hana/transform.hpp>
 
+#include <type_traits>
+
 
 BOOST_HANA_NAMESPACE_BEGIN
     //! @cond
@@ -36,12 +38,31 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr auto apply(Args&& ...) = delete;
     };
 
+    namespace struct_detail {
+        // Like for `accessors`, the keys of most Structs are a tuple of
+        // empty objects, which is default-constructed from its type instead
+        // of being rebuilt every time.
+        template <typename S,
+                  typename Keys = decltype(hana::transform(hana::accessors<S>(), hana::first)),
+                  bool = std::is_empty<Keys>::value &&
+                         std::is_default_constructible<Keys>::value>
+        struct cached_keys {
+            static constexpr Keys get()
+            { return Keys{}; }
+        };
+
+        template <typename S, typename Keys>
+        struct cached_keys<S, Keys, false> {
+            static constexpr auto get()
+            { return hana::transform(hana::accessors<S>(), hana::first); }
+        };
+    }
+
     template <typename S>
     struct keys_impl<S, when<hana::Struct<S>::value>> {
         template <typename Object>
-        static constexpr auto apply(Object const&) {
-            return hana::transform(hana::accessors<S>(), hana::first);
-        }
+        static constexpr auto apply(Object const&)
+        { return struct_detail::cached_keys<S>::get(); }
     };
 BOOST_HANA_NAMESPACE_END
 
@@ -35,7 +35,6 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/first.hpp>
 #include <boost/hana/fold_left.hpp>
 #include <boost/hana/functional/demux.hpp>
-#include <boost/hana/functional/on.hpp>
 #include <boost/hana/functional/partial.hpp>
 #include <boost/hana/fwd/any_of.hpp>
 #include <boost/hana/fwd/at_key.hpp>
@@ -47,10 +46,11 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/keys.hpp>
 #include <boost/hana/length.hpp>
 #include <boost/hana/optional.hpp>
-#include <boost/hana/remove_if.hpp>
+#include <boost/hana/remove_at.hpp>
 #include <boost/hana/second.hpp>
 #include <boost/hana/unpack.hpp>
 #include <boost/hana/value.hpp>
+#include <boost/hana/visit_at.hpp>
 
 #include <cstddef>
 #include <utility>
@@ -129,9 +129,6 @@ BOOST_HANA_NAMESPACE_BEGIN
             "hana::make_map(pairs...) requires all the keys to be "
             "Comparable at compile-time");
 
-            //! @todo
-            //! This can be implemented more efficiently by doing the check
-            //! inside each bucket instead.
             static_assert(!detail::has_duplicates<decltype(hana::first(pairs))...>::value,
             "hana::make_map({keys, values}...) requires all the keys to be unique");
 
@@ -176,16 +173,8 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct insert_impl<map_tag> {
-        template <typename Map, typename Pair>
-        static constexpr auto helper(Map&& map, Pair&& pair, ...) {
-            using RawMap = typename std::remove_reference<Map>::type;
-            using HashTable = typename RawMap::hash_table_type;
-            using NewHashTable = typename detail::bucket_insert<
-                HashTable,
-                decltype(hana::first(pair)),
-                decltype(hana::length(map.storage))::value
-            >::type;
-
+        template <typename NewHashTable, typename Map, typename Pair>
+        static constexpr auto helper(Map&& map, Pair&& pair, hana::optional<>) {
             using NewStorage = decltype(
                 hana::append(static_cast<Map&&>(map).storage, static_cast<Pair&&>(pair))
             );
@@ -194,7 +183,7 @@ BOOST_HANA_NAMESPACE_BEGIN
             );
         }
 
-        template <typename Map, typename Pair, std::size_t i>
+        template <typename NewHashTable, typename Map, typename Pair, std::size_t i>
         static constexpr auto
         helper(Map&& map, Pair&&,
                hana::optional<std::integral_constant<std::size_t, i>>)
@@ -202,20 +191,20 @@ BOOST_HANA_NAMESPACE_BEGIN
             return static_cast<Map&&>(map);
         }
 
-        //! @todo
-        //! Here, we insert only if the key is not already in the map.
-        //! This should be handled by `bucket_insert`, and that would also
-        //! be more efficient.
         template <typename Map, typename Pair>
         static constexpr auto apply(Map&& map, Pair&& pair) {
             using RawMap = typename std::remove_reference<Map>::type;
             using Storage = typename RawMap::storage_type;
             using HashTable = typename RawMap::hash_table_type;
             using Key = decltype(hana::first(pair));
-            using MaybeIndex = typename detail::find_index<
-              HashTable, Key, detail::KeyAtIndex<Storage>::template apply
-            >::type;
-            return helper(static_cast<Map&&>(map), static_cast<Pair&&>(pair), MaybeIndex{});
+            using Insertion = detail::find_or_insert<
+                HashTable, Key, detail::KeyAtIndex<Storage>::template apply,
+                decltype(hana::length(map.storage))::value
+            >;
+            return helper<typename Insertion::type>(
+                static_cast<Map&&>(map), static_cast<Pair&&>(pair),
+                typename Insertion::MaybeIndex{}
+            );
         }
     };
 
@@ -224,30 +213,37 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct erase_key_impl<map_tag> {
-        //! @todo
-        //! We could implement some kind of `bucket_erase` metafunction
-        //! that would be much more efficient than this.
-        template <typename Map, typename Key>
-        static constexpr auto
-        erase_key_helper(Map&& map, Key const&, hana::false_) {
+        template <typename Map>
+        static constexpr auto erase_key_helper(Map&& map, hana::optional<>) {
             return static_cast<Map&&>(map);
         }
 
-        template <typename Map, typename Key>
+        template <typename Map, std::size_t i>
         static constexpr auto
-        erase_key_helper(Map&& map, Key const& key, hana::true_) {
-            return hana::unpack(
-                hana::remove_if(static_cast<Map&&>(map).storage,
-                                hana::on(hana::equal.to(key), hana::first)),
-                hana::make_map
+        erase_key_helper(Map&& map, hana::optional<std::integral_constant<std::size_t, i>>) {
+            using RawMap = typename std::remove_reference<Map>::type;
+            using Storage = typename RawMap::storage_type;
+            using HashTable = typename RawMap::hash_table_type;
+            using NewHashTable = typename detail::bucket_erase<
+                HashTable, typename detail::KeyAtIndex<Storage>::template apply<i>, i
+            >::type;
+            using NewStorage = decltype(
+                hana::remove_at_c<i>(static_cast<Map&&>(map).storage)
+            );
+            return hana::map<NewHashTable, NewStorage>(
+                hana::remove_at_c<i>(static_cast<Map&&>(map).storage)
             );
         }
 
         template <typename Map, typename Key>
-        static constexpr auto apply(Map&& map, Key const& key) {
-            constexpr bool contains = hana::value<decltype(hana::contains(map, key))>();
-            return erase_key_helper(static_cast<Map&&>(map), key,
-                                    hana::bool_c<contains>);
+        static constexpr auto apply(Map&& map, Key const&) {
+            using RawMap = typename std::remove_reference<Map>::type;
+            using Storage = typename RawMap::storage_type;
+            using HashTable = typename RawMap::hash_table_type;
+            using MaybeIndex = typename detail::find_index<
+                HashTable, Key, detail::KeyAtIndex<Storage>::template apply
+            >::type;
+            return erase_key_helper(static_cast<Map&&>(map), MaybeIndex{});
         }
     };
 
@@ -306,6 +302,20 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    template <>
+    struct contains_impl<map_tag> {
+        template <typename Map, typename Key>
+        static constexpr auto apply(Map const&, Key const&) {
+            using RawMap = typename std::remove_reference<Map>::type;
+            using Storage = typename RawMap::storage_type;
+            using HashTable = typename RawMap::hash_table_type;
+            using MaybeIndex = typename detail::find_index<
+                HashTable, Key, detail::KeyAtIndex<Storage>::template apply
+            >::type;
+            return hana::is_just(MaybeIndex{});
+        }
+    };
+
     template <>
     struct find_if_impl<map_tag> {
         template <typename M, typename Pred>
@@ -372,6 +382,32 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // visit_at
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <typename F>
+        struct visit_second {
+            F&& f;
+
+            template <typename Pair>
+            constexpr decltype(auto) operator()(Pair&& pair) const {
+                return static_cast<F&&>(f)(
+                    hana::second(static_cast<Pair&&>(pair))
+                );
+            }
+        };
+    }
+
+    template <>
+    struct visit_at_impl<map_tag> {
+        template <typename M, typename F>
+        static constexpr decltype(auto) apply(M&& map, std::size_t n, F&& f) {
+            return hana::visit_at(static_cast<M&&>(map).storage, n,
+                                  detail::visit_second<F>{static_cast<F&&>(f)});
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Construction from a Foldable
     //////////////////////////////////////////////////////////////////////////
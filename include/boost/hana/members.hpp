@@ -1,6 +1,7 @@
 /*!
 @file
-Defines `boost::hana::members`.
+Defines `boost::hana::members`, `boost::hana::unpack_members` and
+`boost::hana::for_each_member`.
 
 @copyright Louis Dionne 2013-2016
 Distributed under the Boost Software License, Version 1.0.
@@ -16,8 +17,11 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/concept/struct.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/for_each.hpp>
 #include <boost/hana/second.hpp>
 #include <boost/hana/transform.hpp>
+#include <boost/hana/unpack.hpp>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -60,6 +64,75 @@ BOOST_HANA_NAMESPACE_BEGIN
             );
         }
     };
+
+    //////////////////////////////////////////////////////////////////////////
+    // unpack_members
+    //////////////////////////////////////////////////////////////////////////
+    namespace struct_detail {
+        template <typename Object, typename F>
+        struct unpack_members_helper {
+            Object& object;
+            F& f;
+
+            template <typename ...Accessors>
+            constexpr decltype(auto) operator()(Accessors&& ...accessors) const {
+                return static_cast<F&&>(f)(
+                    hana::second(static_cast<Accessors&&>(accessors))(
+                        static_cast<Object&&>(object)
+                    )...
+                );
+            }
+        };
+    }
+
+    //! @cond
+    template <typename Object, typename F>
+    constexpr decltype(auto) unpack_members_t::operator()(Object&& object, F&& f) const {
+        using S = typename hana::tag_of<Object>::type;
+
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(hana::Struct<S>::value,
+            "hana::unpack_members(object, f) requires 'object' to be a Struct");
+        #endif
+
+        return hana::unpack(hana::accessors<S>(),
+            struct_detail::unpack_members_helper<Object, F>{object, f}
+        );
+    }
+    //! @endcond
+
+    //////////////////////////////////////////////////////////////////////////
+    // for_each_member
+    //////////////////////////////////////////////////////////////////////////
+    namespace struct_detail {
+        template <typename Object, typename F>
+        struct for_each_member_helper {
+            Object& object;
+            F& f;
+
+            template <typename Accessor>
+            constexpr void operator()(Accessor&& accessor) const {
+                f(hana::first(accessor),
+                  hana::second(accessor)(static_cast<Object&&>(object)));
+            }
+        };
+    }
+
+    //! @cond
+    template <typename Object, typename F>
+    constexpr void for_each_member_t::operator()(Object&& object, F&& f) const {
+        using S = typename hana::tag_of<Object>::type;
+
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(hana::Struct<S>::value,
+            "hana::for_each_member(object, f) requires 'object' to be a Struct");
+        #endif
+
+        hana::for_each(hana::accessors<S>(),
+            struct_detail::for_each_member_helper<Object, F>{object, f}
+        );
+    }
+    //! @endcond
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_MEMBERS_HPP
@@ -0,0 +1,106 @@
+/*!
+@file
+Defines `boost::hana::nth_permutation` and `boost::hana::nth_permutation_c`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_NTH_PERMUTATION_HPP
+#define BOOST_HANA_NTH_PERMUTATION_HPP
+
+#include <boost/hana/fwd/nth_permutation.hpp>
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/concept/integral_constant.hpp>
+#include <boost/hana/concept/sequence.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/length.hpp>
+
+#include <cstddef>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! @cond
+    template <typename Xs, typename N>
+    constexpr auto nth_permutation_t::operator()(Xs&& xs, N const& n) const {
+        using S = typename hana::tag_of<Xs>::type;
+        using NthPermutation = BOOST_HANA_DISPATCH_IF(nth_permutation_impl<S>,
+            hana::Sequence<S>::value &&
+            hana::IntegralConstant<N>::value
+        );
+
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(hana::Sequence<S>::value,
+        "hana::nth_permutation(xs, n) requires 'xs' to be a Sequence");
+
+        static_assert(hana::IntegralConstant<N>::value,
+        "hana::nth_permutation(xs, n) requires 'n' to be an IntegralConstant");
+    #endif
+
+        return NthPermutation::apply(static_cast<Xs&&>(xs), n);
+    }
+    //! @endcond
+
+    template <typename S, bool condition>
+    struct nth_permutation_impl<S, when<condition>> : default_ {
+        template <typename ...Args>
+        static constexpr auto apply(Args&& ...) = delete;
+    };
+
+    namespace detail {
+        // Returns the indices of the `k`-th permutation of `[0, ..., N-1]`
+        // in lexicographical order. The i-th digit of `k` in the factorial
+        // number system is the position of the i-th index among the indices
+        // that were not selected yet.
+        template <std::size_t N>
+        constexpr detail::array<std::size_t, N> nth_permutation_indices(std::size_t k) {
+            auto remaining = detail::array<std::size_t, N>{}.iota(0);
+            detail::array<std::size_t, N> result{};
+            for (std::size_t i = 0; i < N; ++i) {
+                std::size_t const radix = detail::factorial(N - 1 - i);
+                std::size_t const digit = k / radix;
+                k %= radix;
+                result[i] = remaining[digit];
+                for (std::size_t j = digit; j + 1 < N - i; ++j)
+                    remaining[j] = remaining[j + 1];
+            }
+            return result;
+        }
+    }
+
+    template <typename S>
+    struct nth_permutation_impl<S, when<Sequence<S>::value>> {
+        template <std::size_t n, typename Xs, std::size_t ...i>
+        static constexpr auto
+        nth_permutation_helper(Xs&& xs, std::index_sequence<i...>) {
+            constexpr auto indices = detail::nth_permutation_indices<sizeof...(i)>(n);
+            (void)indices; // workaround GCC warning when sizeof...(i) == 0
+            // Each element appears exactly once, so it may be moved from.
+            return hana::make<S>(hana::at_c<indices[i]>(static_cast<Xs&&>(xs))...);
+        }
+
+        template <typename Xs, typename N>
+        static constexpr auto apply(Xs&& xs, N const&) {
+            constexpr std::size_t len = decltype(hana::length(xs))::value;
+            constexpr std::size_t n = N::value;
+            static_assert(n < detail::factorial(len),
+            "hana::nth_permutation(xs, n) requires 'n' to be smaller than the number of permutations of 'xs'");
+            return nth_permutation_helper<n>(static_cast<Xs&&>(xs),
+                                             std::make_index_sequence<len>{});
+        }
+    };
+
+    template <std::size_t n, typename Xs>
+    constexpr auto nth_permutation_c(Xs&& xs) {
+        return hana::nth_permutation(static_cast<Xs&&>(xs), hana::size_c<n>);
+    }
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_NTH_PERMUTATION_HPP
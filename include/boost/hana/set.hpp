@@ -17,6 +17,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/concept/comparable.hpp>
 #include <boost/hana/concept/constant.hpp>
 #include <boost/hana/concept/hashable.hpp>
+#include <boost/hana/concat.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/contains.hpp>
 #include <boost/hana/core/make.hpp>
@@ -24,23 +25,29 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/detail/decay.hpp>
 #include <boost/hana/detail/fast_and.hpp>
 #include <boost/hana/detail/has_duplicates.hpp>
+#include <boost/hana/detail/hash_table.hpp>
 #include <boost/hana/detail/operators/adl.hpp>
 #include <boost/hana/detail/operators/comparable.hpp>
 #include <boost/hana/detail/operators/searchable.hpp>
 #include <boost/hana/equal.hpp>
 #include <boost/hana/erase_key.hpp>
+#include <boost/hana/filter.hpp>
 #include <boost/hana/find_if.hpp>
 #include <boost/hana/fold_left.hpp>
 #include <boost/hana/fwd/any_of.hpp>
+#include <boost/hana/fwd/at_key.hpp>
+#include <boost/hana/fwd/contains.hpp>
 #include <boost/hana/fwd/core/to.hpp>
 #include <boost/hana/fwd/difference.hpp>
+#include <boost/hana/fwd/find.hpp>
 #include <boost/hana/fwd/intersection.hpp>
 #include <boost/hana/fwd/union.hpp>
 #include <boost/hana/insert.hpp>
 #include <boost/hana/is_subset.hpp>
 #include <boost/hana/length.hpp>
+#include <boost/hana/optional.hpp>
 #include <boost/hana/or.hpp>
-#include <boost/hana/remove.hpp>
+#include <boost/hana/remove_at.hpp>
 #include <boost/hana/tuple.hpp>
 #include <boost/hana/unpack.hpp>
 #include <boost/hana/value.hpp>
@@ -55,11 +62,13 @@ BOOST_HANA_NAMESPACE_BEGIN
     // set
     //////////////////////////////////////////////////////////////////////////
     //! @cond
-    template <typename ...Xs>
+    template <typename HashTable, typename ...Xs>
     struct set
-        : detail::operators::adl<set<Xs...>>
-        , detail::searchable_operators<set<Xs...>>
+        : detail::operators::adl<set<HashTable, Xs...>>
+        , detail::searchable_operators<set<HashTable, Xs...>>
     {
+        using hash_table_type = HashTable;
+
         tuple<Xs...> storage;
         using hana_tag = set_tag;
         static constexpr std::size_t size = sizeof...(Xs);
@@ -77,6 +86,45 @@ BOOST_HANA_NAMESPACE_BEGIN
     };
     //! @endcond
 
+    namespace detail {
+        template <typename ...Xs>
+        struct SetKeyAtIndex {
+            template <std::size_t i>
+            using apply = decltype(hana::get_impl<i>(std::declval<basic_tuple<Xs...>>()));
+        };
+
+        template <typename ...Xs>
+        struct make_set_type {
+            using type = hana::set<
+                typename detail::make_colliding_hash_table<
+                    SetKeyAtIndex<Xs...>::template apply, sizeof...(Xs)
+                >::type,
+                Xs...
+            >;
+        };
+
+        template <typename ...Xs>
+        constexpr auto set_from_storage(hana::tuple<Xs...>&& storage) {
+            using Set = typename make_set_type<Xs...>::type;
+            return Set{static_cast<hana::tuple<Xs...>&&>(storage)};
+        }
+
+        template <typename HashTable, typename ...Xs>
+        constexpr auto set_with_hash_table(hana::tuple<Xs...>&& storage) {
+            using Set = hana::set<HashTable, Xs...>;
+            return Set{static_cast<hana::tuple<Xs...>&&>(storage)};
+        }
+
+        template <typename Set, typename Key>
+        struct set_find_index;
+
+        template <typename HashTable, typename ...Xs, typename Key>
+        struct set_find_index<hana::set<HashTable, Xs...>, Key>
+            : find_index<HashTable, Key, SetKeyAtIndex<Xs...>::template apply>
+        { };
+
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // Operators
     //////////////////////////////////////////////////////////////////////////
@@ -111,9 +159,10 @@ BOOST_HANA_NAMESPACE_BEGIN
             "hana::make_set(xs...) requires all the 'xs' to be unique");
 #endif
 
-            return set<typename detail::decay<Xs>::type...>{
-                hana::make_tuple(static_cast<Xs&&>(xs)...)
-            };
+            using Set = typename detail::make_set_type<
+                typename detail::decay<Xs>::type...
+            >::type;
+            return Set{hana::make_tuple(static_cast<Xs&&>(xs)...)};
         }
     };
 
@@ -154,6 +203,51 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     // Searchable
     //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct find_impl<set_tag> {
+        template <typename Xs>
+        static constexpr auto find_helper(Xs&&, hana::optional<>) {
+            return hana::nothing;
+        }
+
+        template <typename Xs, std::size_t i>
+        static constexpr auto
+        find_helper(Xs&& xs, hana::optional<std::integral_constant<std::size_t, i>>) {
+            return hana::just(hana::at_c<i>(static_cast<Xs&&>(xs).storage));
+        }
+
+        template <typename Xs, typename Key>
+        static constexpr auto apply(Xs&& xs, Key const&) {
+            using MaybeIndex = typename detail::set_find_index<
+                typename detail::decay<Xs>::type, Key
+            >::type;
+            return find_helper(static_cast<Xs&&>(xs), MaybeIndex{});
+        }
+    };
+
+    template <>
+    struct contains_impl<set_tag> {
+        template <typename Xs, typename Key>
+        static constexpr auto apply(Xs const&, Key const&) {
+            using MaybeIndex = typename detail::set_find_index<
+                typename detail::decay<Xs>::type, Key
+            >::type;
+            return hana::is_just(MaybeIndex{});
+        }
+    };
+
+    template <>
+    struct at_key_impl<set_tag> {
+        template <typename Xs, typename Key>
+        static constexpr decltype(auto) apply(Xs&& xs, Key const&) {
+            using MaybeIndex = typename detail::set_find_index<
+                typename detail::decay<Xs>::type, Key
+            >::type;
+            constexpr std::size_t index = decltype(*MaybeIndex{}){}();
+            return hana::at_c<index>(static_cast<Xs&&>(xs).storage);
+        }
+    };
+
     template <>
     struct find_if_impl<set_tag> {
         template <typename Xs, typename Pred>
@@ -217,28 +311,59 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     // insert
     //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <typename Set, typename X>
+        struct set_insert;
+
+        template <typename HashTable, typename ...Xs, typename X>
+        struct set_insert<hana::set<HashTable, Xs...>, X> {
+            using Insertion = find_or_insert<
+                HashTable, X, SetKeyAtIndex<Xs...>::template apply, sizeof...(Xs)
+            >;
+            using MaybeIndex = typename Insertion::MaybeIndex;
+            using type = hana::set<typename Insertion::type, Xs..., X>;
+        };
+
+        template <typename Set, std::size_t i>
+        struct set_erase;
+
+        template <typename HashTable, typename ...Xs, std::size_t i>
+        struct set_erase<hana::set<HashTable, Xs...>, i>
+            : bucket_erase<
+                HashTable, typename SetKeyAtIndex<Xs...>::template apply<i>, i
+            >
+        { };
+    }
+
     template <>
     struct insert_impl<set_tag> {
-        template <typename Xs, typename X, typename Indices>
+        template <typename NewSet, typename Xs, typename X, typename Indices, std::size_t i>
         static constexpr auto
-        insert_helper(Xs&& xs, X&&, hana::true_, Indices) {
+        insert_helper(Xs&& xs, X&&, Indices,
+                      hana::optional<std::integral_constant<std::size_t, i>>)
+        {
             return static_cast<Xs&&>(xs);
         }
 
-        template <typename Xs, typename X, std::size_t ...n>
+        template <typename NewSet, typename Xs, typename X, std::size_t ...n>
         static constexpr auto
-        insert_helper(Xs&& xs, X&& x, hana::false_, std::index_sequence<n...>) {
-            return hana::make_set(
+        insert_helper(Xs&& xs, X&& x, std::index_sequence<n...>, hana::optional<>) {
+            return NewSet{hana::make_tuple(
                 hana::at_c<n>(static_cast<Xs&&>(xs).storage)..., static_cast<X&&>(x)
-            );
+            )};
         }
 
         template <typename Xs, typename X>
         static constexpr auto apply(Xs&& xs, X&& x) {
-            constexpr bool c = hana::value<decltype(hana::contains(xs, x))>();
-            constexpr std::size_t size = std::remove_reference<Xs>::type::size;
-            return insert_helper(static_cast<Xs&&>(xs), static_cast<X&&>(x),
-                                 hana::bool_c<c>, std::make_index_sequence<size>{});
+            using RawSet = typename detail::decay<Xs>::type;
+            using Insertion = detail::set_insert<
+                RawSet, typename detail::decay<X>::type
+            >;
+            return insert_helper<typename Insertion::type>(
+                static_cast<Xs&&>(xs), static_cast<X&&>(x),
+                std::make_index_sequence<RawSet::size>{},
+                typename Insertion::MaybeIndex{}
+            );
         }
     };
 
@@ -247,40 +372,47 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct erase_key_impl<set_tag> {
-        template <typename Xs, typename X>
-        static constexpr decltype(auto) apply(Xs&& xs, X&& x) {
-            return hana::unpack(
-                hana::remove(static_cast<Xs&&>(xs).storage,
-                             static_cast<X&&>(x)),
-                hana::make_set
+        template <typename Xs>
+        static constexpr auto erase_key_helper(Xs&& xs, hana::optional<>) {
+            return static_cast<Xs&&>(xs);
+        }
+
+        template <typename Xs, std::size_t i>
+        static constexpr auto
+        erase_key_helper(Xs&& xs, hana::optional<std::integral_constant<std::size_t, i>>) {
+            using NewHashTable = typename detail::set_erase<
+                typename detail::decay<Xs>::type, i
+            >::type;
+            return detail::set_with_hash_table<NewHashTable>(
+                hana::remove_at_c<i>(static_cast<Xs&&>(xs).storage)
             );
         }
+
+        template <typename Xs, typename X>
+        static constexpr auto apply(Xs&& xs, X const&) {
+            using MaybeIndex = typename detail::set_find_index<
+                typename detail::decay<Xs>::type, X
+            >::type;
+            return erase_key_helper(static_cast<Xs&&>(xs), MaybeIndex{});
+        }
     };
 
     //////////////////////////////////////////////////////////////////////////
     // intersection
     //////////////////////////////////////////////////////////////////////////
     namespace detail {
-        template <typename Ys>
-        struct set_insert_if_contains {
+        // Returns whether an element is contained in `ys` (when `Contained`
+        // is true) or whether it is missing from `ys` (when it is false).
+        // Since lookup in a set is done through its hash table, filtering
+        // a set with this predicate is linear in the number of elements.
+        template <typename Ys, bool Contained>
+        struct set_membership {
             Ys const& ys;
 
-            template <typename Result, typename Key>
-            static constexpr auto helper(Result&& result, Key&& key, hana::true_) {
-                return hana::insert(static_cast<Result&&>(result), static_cast<Key&&>(key));
-            }
-
-            template <typename Result, typename Key>
-            static constexpr auto helper(Result&& result, Key&&, hana::false_) {
-                return static_cast<Result&&>(result);
-            }
-
-            template <typename Result, typename Key>
-            constexpr auto operator()(Result&& result, Key&& key) const {
-                constexpr bool keep = hana::value<decltype(hana::contains(ys, key))>();
-                return set_insert_if_contains::helper(static_cast<Result&&>(result),
-                                                      static_cast<Key&&>(key),
-                                                      hana::bool_c<keep>);
+            template <typename X>
+            constexpr auto operator()(X const& x) const {
+                constexpr bool contains = hana::value<decltype(hana::contains(ys, x))>();
+                return hana::bool_c<contains == Contained>;
             }
         };
     }
@@ -289,8 +421,10 @@ BOOST_HANA_NAMESPACE_BEGIN
     struct intersection_impl<set_tag> {
         template <typename Xs, typename Ys>
         static constexpr auto apply(Xs&& xs, Ys const& ys) {
-            return hana::fold_left(static_cast<Xs&&>(xs), hana::make_set(),
-                                   detail::set_insert_if_contains<Ys>{ys});
+            return detail::set_from_storage(
+                hana::filter(static_cast<Xs&&>(xs).storage,
+                             detail::set_membership<Ys, true>{ys})
+            );
         }
     };
 
@@ -301,8 +435,13 @@ BOOST_HANA_NAMESPACE_BEGIN
     struct union_impl<set_tag> {
         template <typename Xs, typename Ys>
         static constexpr auto apply(Xs&& xs, Ys&& ys) {
-            return hana::fold_left(static_cast<Xs&&>(xs), static_cast<Ys&&>(ys),
-                                   hana::insert);
+            return detail::set_from_storage(hana::concat(
+                static_cast<Ys&&>(ys).storage,
+                hana::filter(static_cast<Xs&&>(xs).storage,
+                             detail::set_membership<
+                                typename std::remove_reference<Ys>::type, false
+                             >{ys})
+            ));
         }
     };
 
@@ -312,9 +451,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     template <>
     struct difference_impl<set_tag> {
         template <typename Xs, typename Ys>
-        static constexpr auto apply(Xs&& xs, Ys&& ys) {
-            return hana::fold_left(static_cast<Ys&&>(ys), static_cast<Xs&&>(xs),
-                                   hana::erase_key);
+        static constexpr auto apply(Xs&& xs, Ys const& ys) {
+            return detail::set_from_storage(
+                hana::filter(static_cast<Xs&&>(xs).storage,
+                             detail::set_membership<Ys, false>{ys})
+            );
         }
     };
 BOOST_HANA_NAMESPACE_END
@@ -21,6 +21,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/length.hpp>
 #include <boost/hana/less.hpp>
 
+#include <cstddef>
+#include <type_traits>
 #include <utility> // std::declval, std::index_sequence
 
 
@@ -135,15 +137,186 @@ BOOST_HANA_NAMESPACE_BEGIN
             using type = Result;
         };
 
-        template <typename Pred, typename Indices>
-        struct sort_helper;
+        // merge_sort_impl:
+        //  Stable merge sort of a sequence of indices. Two sorted sequences
+        //  are merged by taking the middle element of the longest one and
+        //  looking for its position in the other one with a binary search.
+        //  The elements on each side of that split point are then merged
+        //  independently. This requires O(n) comparisons for a merge, and
+        //  hence O(n log n) comparisons for the sort. Since all the recursive
+        //  steps split the sequences in halves, the template recursion depth
+        //  is only O(log n). Short sequences are handled by the insertion
+        //  sort above, which requires fewer instantiations in that case.
+        template <std::size_t ...i>
+        struct sort_sequence {
+            static constexpr std::size_t size = sizeof...(i);
+
+            static constexpr std::size_t at(std::size_t n) {
+                constexpr std::size_t indices[] = {i..., 0}; // avoid empty array
+                return indices[n];
+            }
+
+            template <std::size_t From, std::size_t ...n>
+            static std::index_sequence<at(From + n)...>
+            slice_impl(std::index_sequence<n...>);
+
+            template <std::size_t From, std::size_t To>
+            using slice = decltype(
+                slice_impl<From>(std::make_index_sequence<To - From>{})
+            );
+        };
+
+        template <typename Indices>
+        struct as_sort_sequence;
+
+        template <std::size_t ...i>
+        struct as_sort_sequence<std::index_sequence<i...>> {
+            using type = sort_sequence<i...>;
+        };
+
+        template <typename Left, std::size_t Middle, typename Right>
+        struct sort_join;
+
+        template <std::size_t ...left, std::size_t Middle, std::size_t ...right>
+        struct sort_join<std::index_sequence<left...>, Middle,
+                         std::index_sequence<right...>>
+        {
+            using type = std::index_sequence<left..., Middle, right...>;
+        };
+
+        // Returns the number of elements at the beginning of the sorted
+        // sequence `Seq` (between `Lo` and `Hi`) that must come before `X`.
+        // When `XIsLeft` is true, `X` comes from the left sequence and
+        // equivalent elements must go after it; otherwise, they must go
+        // before it. This is what makes the merge stable.
+        template <typename Pred, std::size_t X, bool XIsLeft, std::size_t Y>
+        struct sort_goes_before
+            : std::integral_constant<bool,
+                (bool)Pred::template apply<Y, X>::value
+            >
+        { };
+
+        template <typename Pred, std::size_t X, std::size_t Y>
+        struct sort_goes_before<Pred, X, false, Y>
+            : std::integral_constant<bool,
+                !(bool)Pred::template apply<X, Y>::value
+            >
+        { };
+
+        template <typename Pred, std::size_t X, bool XIsLeft, typename Seq,
+                  std::size_t Lo, std::size_t Hi, bool = (Lo < Hi)>
+        struct sort_partition_point {
+            static constexpr std::size_t value = Lo;
+        };
+
+        template <typename Pred, std::size_t X, bool XIsLeft, typename Seq,
+                  std::size_t Lo, std::size_t Hi>
+        struct sort_partition_point<Pred, X, XIsLeft, Seq, Lo, Hi, true> {
+            static constexpr std::size_t Mid = Lo + (Hi - Lo) / 2;
+            static constexpr std::size_t value = std::conditional<
+                sort_goes_before<Pred, X, XIsLeft, Seq::at(Mid)>::value,
+                sort_partition_point<Pred, X, XIsLeft, Seq, Mid + 1, Hi>,
+                sort_partition_point<Pred, X, XIsLeft, Seq, Lo, Mid>
+            >::type::value;
+        };
+
+        template <typename Pred, typename Left, typename Right>
+        struct merge_impl;
+
+        // Split `Left` at its middle element and `Right` at the position of
+        // that element in `Right`.
+        template <typename Pred, typename Left, typename Right>
+        struct merge_split_left {
+            static constexpr std::size_t k = Left::size / 2;
+            static constexpr std::size_t j = sort_partition_point<
+                Pred, Left::at(k), true, Right, 0, Right::size
+            >::value;
+            using type = typename sort_join<
+                typename merge_impl<Pred,
+                    typename Left::template slice<0, k>,
+                    typename Right::template slice<0, j>
+                >::type,
+                Left::at(k),
+                typename merge_impl<Pred,
+                    typename Left::template slice<k + 1, Left::size>,
+                    typename Right::template slice<j, Right::size>
+                >::type
+            >::type;
+        };
+
+        // Split `Right` at its middle element and `Left` at the position of
+        // that element in `Left`.
+        template <typename Pred, typename Left, typename Right>
+        struct merge_split_right {
+            static constexpr std::size_t k = Right::size / 2;
+            static constexpr std::size_t j = sort_partition_point<
+                Pred, Right::at(k), false, Left, 0, Left::size
+            >::value;
+            using type = typename sort_join<
+                typename merge_impl<Pred,
+                    typename Left::template slice<0, j>,
+                    typename Right::template slice<0, k>
+                >::type,
+                Right::at(k),
+                typename merge_impl<Pred,
+                    typename Left::template slice<j, Left::size>,
+                    typename Right::template slice<k + 1, Right::size>
+                >::type
+            >::type;
+        };
+
+        template <typename Pred, std::size_t ...left, std::size_t ...right>
+        struct merge_impl<Pred, std::index_sequence<left...>,
+                                std::index_sequence<right...>>
+            : std::conditional<(sizeof...(left) >= sizeof...(right)),
+                merge_split_left<Pred, sort_sequence<left...>, sort_sequence<right...>>,
+                merge_split_right<Pred, sort_sequence<left...>, sort_sequence<right...>>
+            >::type
+        { };
+
+        template <typename Pred, std::size_t ...left>
+        struct merge_impl<Pred, std::index_sequence<left...>, std::index_sequence<>> {
+            using type = std::index_sequence<left...>;
+        };
+
+        template <typename Pred, std::size_t ...right>
+        struct merge_impl<Pred, std::index_sequence<>, std::index_sequence<right...>> {
+            using type = std::index_sequence<right...>;
+        };
+
+        template <typename Pred>
+        struct merge_impl<Pred, std::index_sequence<>, std::index_sequence<>> {
+            using type = std::index_sequence<>;
+        };
+
+        template <typename Pred, typename Indices,
+                  bool = (Indices::size() <= 8)>
+        struct merge_sort_impl;
 
         template <typename Pred, std::size_t ...i>
-        struct sort_helper<Pred, std::index_sequence<i...>> {
+        struct merge_sort_impl<Pred, std::index_sequence<i...>, true> {
             using type = typename insertion_sort_impl<
                 Pred, std::index_sequence<>, i...
             >::type;
         };
+
+        template <typename Pred, std::size_t ...i>
+        struct merge_sort_impl<Pred, std::index_sequence<i...>, false> {
+            using Seq = sort_sequence<i...>;
+            using type = typename merge_impl<Pred,
+                typename merge_sort_impl<Pred,
+                    typename Seq::template slice<0, Seq::size / 2>
+                >::type,
+                typename merge_sort_impl<Pred,
+                    typename Seq::template slice<Seq::size / 2, Seq::size>
+                >::type
+            >::type;
+        };
+
+        template <typename Pred, typename Indices>
+        struct sort_helper {
+            using type = typename merge_sort_impl<Pred, Indices>::type;
+        };
     } // end namespace detail
 
     template <typename S, bool condition>
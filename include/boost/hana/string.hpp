@@ -16,6 +16,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/make.hpp>
 #include <boost/hana/detail/algorithm.hpp>
+#include <boost/hana/detail/array.hpp>
 #include <boost/hana/detail/operators/adl.hpp>
 #include <boost/hana/detail/operators/comparable.hpp>
 #include <boost/hana/detail/operators/iterable.hpp>
@@ -36,7 +37,9 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/if.hpp>
 #include <boost/hana/integral_constant.hpp>
 #include <boost/hana/optional.hpp>
+#include <boost/hana/tuple.hpp>
 #include <boost/hana/type.hpp>
+#include <boost/hana/unpack.hpp>
 
 #include <utility>
 #include <cstddef>
@@ -285,6 +288,280 @@ BOOST_HANA_NAMESPACE_BEGIN
             return hana::type_c<String>;
         }
     };
+
+    //////////////////////////////////////////////////////////////////////////
+    // String operations
+    //////////////////////////////////////////////////////////////////////////
+    namespace string_detail {
+        // Computes the table used by the Knuth-Morris-Pratt algorithm for
+        // the non-empty pattern `p` of length `M`. `table[i]` is the length
+        // of the longest proper prefix of `p[0..i]` that is also a suffix
+        // of `p[0..i]`.
+        template <std::size_t M>
+        constexpr detail::array<std::size_t, M> kmp_table(char const* p) {
+            detail::array<std::size_t, M> table{};
+            std::size_t k = 0;
+            for (std::size_t i = 1; i < M; ++i) {
+                while (k > 0 && p[i] != p[k])
+                    k = table[k - 1];
+                if (p[i] == p[k])
+                    ++k;
+                table[i] = k;
+            }
+            return table;
+        }
+
+        // Finds the non-overlapping occurrences of the non-empty pattern `p`
+        // of length `M` in the string `s` of length `n`, from left to right.
+        // The positions of the first `max` occurrences are written to `out`,
+        // unless `out` is null, and the number of occurrences written is
+        // returned.
+        template <std::size_t M>
+        constexpr std::size_t find_all(char const* s, std::size_t n,
+                                       char const* p,
+                                       std::size_t* out, std::size_t max)
+        {
+            detail::array<std::size_t, M> const table = string_detail::kmp_table<M>(p);
+            std::size_t count = 0;
+            std::size_t k = 0;
+            for (std::size_t i = 0; i < n && count < max; ++i) {
+                while (k > 0 && s[i] != p[k])
+                    k = table[k - 1];
+                if (s[i] == p[k])
+                    ++k;
+                if (k == M) {
+                    if (out)
+                        out[count] = i + 1 - M;
+                    ++count;
+                    k = 0;
+                }
+            }
+            return count;
+        }
+
+        template <std::size_t M>
+        constexpr std::size_t find_first(char const* s, std::size_t n, char const* p) {
+            std::size_t pos = n + 1;
+            string_detail::find_all<M>(s, n, p, &pos, 1);
+            return pos;
+        }
+
+        // Writes the characters of a string or a `Constant` character to `out`,
+        // and returns the position following the last character written.
+        template <char ...s>
+        constexpr char* copy(char* out, string<s...> const&) {
+            constexpr char const chars[] = {s..., '\0'};
+            for (std::size_t i = 0; i < sizeof...(s); ++i)
+                *out++ = chars[i];
+            return out;
+        }
+
+        template <typename Char>
+        constexpr char* copy(char* out, Char const&) {
+            *out++ = hana::value<Char>();
+            return out;
+        }
+
+        template <typename T>
+        struct length {
+            static constexpr std::size_t value = 1;
+        };
+
+        template <char ...s>
+        struct length<string<s...>> {
+            static constexpr std::size_t value = sizeof...(s);
+        };
+
+        // Creates the `hana::string` holding the characters of the `chars`
+        // array of `Result` starting at position `from`.
+        template <typename Result, std::size_t from, std::size_t ...i>
+        constexpr string<Result::chars[from + i]...>
+        from_chars(std::index_sequence<i...>)
+        { return {}; }
+
+        template <char c, char ...s>
+        struct split_positions {
+            static constexpr std::size_t count() {
+                constexpr char const chars[] = {s..., '\0'};
+                return detail::count(chars, chars + sizeof...(s), c);
+            }
+
+            // The positions of the separators, followed by the length of the
+            // string. The `i`-th piece of the string ends at `ends[i]`, and
+            // it starts right after the separator ending the previous piece.
+            static constexpr auto compute_ends() {
+                constexpr char const chars[] = {s..., '\0'};
+                detail::array<std::size_t, count() + 1> ends{};
+                std::size_t* out = &ends[0];
+                for (std::size_t i = 0; i < sizeof...(s); ++i)
+                    if (chars[i] == c)
+                        *out++ = i;
+                *out = sizeof...(s);
+                return ends;
+            }
+
+            static constexpr auto ends = compute_ends();
+
+            static constexpr detail::array<char, sizeof...(s)> chars = {{s...}};
+
+            static constexpr std::size_t begin(std::size_t i)
+            { return i == 0 ? 0 : ends[i - 1] + 1; }
+        };
+
+        template <typename Positions, std::size_t ...i>
+        constexpr auto split_helper(std::index_sequence<i...>) {
+            return hana::make_tuple(
+                string_detail::from_chars<Positions, Positions::begin(i)>(
+                    std::make_index_sequence<Positions::ends[i] - Positions::begin(i)>{}
+                )...
+            );
+        }
+
+        template <typename Str, typename OldSub, typename NewSub>
+        struct replace_result;
+
+        template <char ...s, char ...oldsub, char ...newsub>
+        struct replace_result<string<s...>, string<oldsub...>, string<newsub...>> {
+            static_assert(sizeof...(oldsub) > 0,
+            "hana::replace_substring(str, oldsub, newsub) requires 'oldsub' to be non-empty");
+
+            static constexpr std::size_t count() {
+                constexpr char const str[] = {s..., '\0'};
+                constexpr char const old[] = {oldsub..., '\0'};
+                return string_detail::find_all<sizeof...(oldsub)>(
+                    str, sizeof...(s), old, nullptr, sizeof...(s));
+            }
+
+            static constexpr std::size_t length =
+                sizeof...(s) - count() * sizeof...(oldsub) + count() * sizeof...(newsub);
+
+            static constexpr auto compute_chars() {
+                constexpr char const str[] = {s..., '\0'};
+                constexpr char const old[] = {oldsub..., '\0'};
+                detail::array<std::size_t, count()> positions{};
+                string_detail::find_all<sizeof...(oldsub)>(
+                    str, sizeof...(s), old, &positions[0], count());
+
+                detail::array<char, length> result{};
+                char* out = &result[0];
+                std::size_t i = 0;
+                for (std::size_t match = 0; match < count(); ++match) {
+                    for (; i < positions[match]; ++i)
+                        *out++ = str[i];
+                    out = string_detail::copy(out, string<newsub...>{});
+                    i += sizeof...(oldsub);
+                }
+                for (; i < sizeof...(s); ++i)
+                    *out++ = str[i];
+                return result;
+            }
+
+            static constexpr auto chars = compute_chars();
+        };
+
+        template <typename Separator, typename ...Strings>
+        struct join_result {
+            static constexpr std::size_t compute_length() {
+                constexpr std::size_t lengths[] = {0, string_detail::length<Strings>::value...};
+                std::size_t total = sizeof...(Strings) > 0
+                    ? (sizeof...(Strings) - 1) * string_detail::length<Separator>::value
+                    : 0;
+                for (std::size_t length : lengths)
+                    total += length;
+                return total;
+            }
+
+            static constexpr std::size_t length = compute_length();
+
+            static constexpr auto compute_chars() {
+                detail::array<char, length> result{};
+                char* out = &result[0];
+                bool first = true;
+                int expand[] = {0, (out = string_detail::copy(
+                    first ? (first = false, out)
+                          : string_detail::copy(out, Separator{}),
+                    Strings{}
+                ), 0)...};
+                (void)expand; (void)first; (void)out; // for empty Strings...
+                return result;
+            }
+
+            static constexpr auto chars = compute_chars();
+        };
+
+        template <typename Separator>
+        struct joiner {
+            template <typename ...Strings>
+            constexpr auto operator()(Strings const& ...) const {
+                using Result = join_result<Separator, Strings...>;
+                return string_detail::from_chars<Result, 0>(
+                    std::make_index_sequence<Result::length>{});
+            }
+        };
+    }
+
+    //! @cond
+    template <char ...s, char ...sub>
+    constexpr auto
+    find_substring_t::operator()(string<s...> const&, string<sub...> const&) const {
+        constexpr char const str[] = {s..., '\0'};
+        constexpr char const pattern[] = {sub..., '\0'};
+        constexpr std::size_t pos = sizeof...(sub) == 0 ? 0
+            : string_detail::find_first<sizeof...(sub)>(str, sizeof...(s), pattern);
+        return hana::if_(hana::bool_c<(pos <= sizeof...(s))>,
+            hana::just(hana::size_c<pos>),
+            hana::nothing
+        );
+    }
+
+    template <char ...s, char ...prefix>
+    constexpr auto
+    starts_with_t::operator()(string<s...> const&, string<prefix...> const&) const {
+        constexpr char const str[] = {s..., '\0'};
+        constexpr char const pre[] = {prefix..., '\0'};
+        constexpr std::size_t m = sizeof...(prefix);
+        return hana::bool_c<
+            m <= sizeof...(s) && detail::equal(pre, pre + m, str, str + m)
+        >;
+    }
+
+    template <char ...s, char ...suffix>
+    constexpr auto
+    ends_with_t::operator()(string<s...> const&, string<suffix...> const&) const {
+        constexpr char const str[] = {s..., '\0'};
+        constexpr char const suf[] = {suffix..., '\0'};
+        constexpr std::size_t n = sizeof...(s);
+        constexpr std::size_t m = sizeof...(suffix);
+        return hana::bool_c<
+            m <= n && detail::equal(suf, suf + m, str + (n - m), str + n)
+        >;
+    }
+
+    template <char ...s, typename Char>
+    constexpr auto split_t::operator()(string<s...> const&, Char const&) const {
+        using Positions = string_detail::split_positions<hana::value<Char>(), s...>;
+        return string_detail::split_helper<Positions>(
+            std::make_index_sequence<Positions::count() + 1>{});
+    }
+
+    template <char ...s, char ...oldsub, char ...newsub>
+    constexpr auto replace_substring_t::operator()(string<s...> const&,
+                                                   string<oldsub...> const&,
+                                                   string<newsub...> const&) const
+    {
+        using Result = string_detail::replace_result<
+            string<s...>, string<oldsub...>, string<newsub...>
+        >;
+        return string_detail::from_chars<Result, 0>(
+            std::make_index_sequence<Result::length>{});
+    }
+
+    template <typename Xs, typename Separator>
+    constexpr auto join_t::operator()(Xs&& xs, Separator const&) const {
+        return hana::unpack(static_cast<Xs&&>(xs),
+                            string_detail::joiner<Separator>{});
+    }
+    //! @endcond
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_STRING_HPP
@@ -0,0 +1,91 @@
+/*!
+@file
+Defines `boost::hana::visit_at`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_VISIT_AT_HPP
+#define BOOST_HANA_VISIT_AT_HPP
+
+#include <boost/hana/fwd/visit_at.hpp>
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/concept/foldable.hpp>
+#include <boost/hana/concept/iterable.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/length.hpp>
+
+#include <cstddef>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! @cond
+    template <typename Xs, typename N, typename F>
+    constexpr decltype(auto) visit_at_t::operator()(Xs&& xs, N const& n, F&& f) const {
+        using S = typename hana::tag_of<Xs>::type;
+        using VisitAt = BOOST_HANA_DISPATCH_IF(visit_at_impl<S>,
+            hana::Foldable<S>::value
+        );
+
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(hana::Foldable<S>::value,
+        "hana::visit_at(xs, n, f) requires 'xs' to be Foldable");
+    #endif
+
+        return VisitAt::apply(static_cast<Xs&&>(xs),
+                              static_cast<std::size_t>(n),
+                              static_cast<F&&>(f));
+    }
+    //! @endcond
+
+    template <typename S, bool condition>
+    struct visit_at_impl<S, when<condition>> : default_ {
+        template <typename ...Args>
+        static constexpr auto apply(Args&& ...) = delete;
+    };
+
+    namespace detail {
+        template <typename Result, typename Xs, typename F, typename Indices>
+        struct visit_at_table;
+
+        template <typename Result, typename Xs, typename F, std::size_t ...i>
+        struct visit_at_table<Result, Xs, F, std::index_sequence<i...>> {
+            template <std::size_t n>
+            static constexpr Result call(Xs&& xs, F&& f) {
+                return static_cast<F&&>(f)(hana::at_c<n>(static_cast<Xs&&>(xs)));
+            }
+
+            using Visitor = Result (*)(Xs&&, F&&);
+            static constexpr Visitor table[] = {&call<i>...};
+        };
+
+        template <typename Result, typename Xs, typename F, std::size_t ...i>
+        constexpr typename visit_at_table<Result, Xs, F, std::index_sequence<i...>>::Visitor
+        visit_at_table<Result, Xs, F, std::index_sequence<i...>>::table[];
+    }
+
+    template <typename S>
+    struct visit_at_impl<S, when<hana::Iterable<S>::value>> {
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, std::size_t n, F&& f) {
+            constexpr std::size_t N = decltype(hana::length(xs))::value;
+            static_assert(N > 0,
+            "hana::visit_at(xs, n, f) requires 'xs' to be non-empty");
+
+            using Result = decltype(std::declval<F>()(
+                hana::at_c<0>(std::declval<Xs>())
+            ));
+            using Table = detail::visit_at_table<
+                Result, Xs, F, std::make_index_sequence<N>
+            >;
+            return Table::table[n](static_cast<Xs&&>(xs), static_cast<F&&>(f));
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_VISIT_AT_HPP
@@ -0,0 +1,127 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HANA_TEST_AUTO_FOR_EACH_PERMUTATION_HPP
+#define BOOST_HANA_TEST_AUTO_FOR_EACH_PERMUTATION_HPP
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/for_each_permutation.hpp>
+
+#include "test_case.hpp"
+#include <laws/base.hpp>
+#include <support/tracked.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace _test_for_each_permutation_detail {
+    // Records each permutation as a string, with one character per element.
+    struct record {
+        std::vector<std::string>* seen;
+
+        template <int ...i>
+        void operator()(boost::hana::test::ct_eq<i> const& ...) const
+        { seen->push_back(std::string{static_cast<char>('0' + i)...}); }
+    };
+
+    struct count {
+        int* calls;
+
+        template <typename ...Xs>
+        void operator()(Xs const& ...) const { ++*calls; }
+    };
+
+    struct increment_first {
+        void operator()(int& x, int const&, int const&) const { ++x; }
+    };
+
+    struct check_not_moved {
+        void operator()(Tracked const& x, Tracked const& y) const {
+            Tracked a = x, b = y;
+            (void)a; (void)b;
+        }
+    };
+
+    struct weighted_sum {
+        int* total;
+
+        constexpr void operator()(int x, int y, int z) const
+        { *total += 100 * x + 10 * y + z; }
+    };
+
+    constexpr int permutation_sum() {
+        int total = 0;
+        boost::hana::for_each_permutation(MAKE_TUPLE(1, 2, 3), weighted_sum{&total});
+        return total;
+    }
+}
+
+
+TestCase test_for_each_permutation{[]{
+    namespace hana = boost::hana;
+    using hana::test::ct_eq;
+    using _test_for_each_permutation_detail::record;
+    using Seen = std::vector<std::string>;
+
+    // the empty sequence has a single permutation
+    {
+        int calls = 0;
+        hana::for_each_permutation(MAKE_TUPLE(), _test_for_each_permutation_detail::count{&calls});
+        BOOST_HANA_RUNTIME_CHECK(calls == 1);
+    }
+
+    {
+        Seen seen;
+        hana::for_each_permutation(MAKE_TUPLE(ct_eq<0>{}), record{&seen});
+        BOOST_HANA_RUNTIME_CHECK(seen == Seen{"0"});
+    }{
+        Seen seen;
+        hana::for_each_permutation(MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}), record{&seen});
+        BOOST_HANA_RUNTIME_CHECK(seen == (Seen{"01", "10"}));
+    }{
+        Seen seen;
+        hana::for_each_permutation(MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}),
+                                   record{&seen});
+        BOOST_HANA_RUNTIME_CHECK(seen == (Seen{"012", "021", "102", "120", "201", "210"}));
+    }{
+        Seen seen;
+        hana::for_each_permutation(MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{}),
+                                   record{&seen});
+        BOOST_HANA_RUNTIME_CHECK(seen == (Seen{
+            "0123", "0132", "0213", "0231", "0312", "0321",
+            "1023", "1032", "1203", "1230", "1302", "1320",
+            "2013", "2031", "2103", "2130", "2301", "2310",
+            "3012", "3021", "3102", "3120", "3201", "3210"
+        }));
+    }{
+        int calls = 0;
+        hana::for_each_permutation(MAKE_TUPLE(1, '2', 3.0, 4u, 5.0f),
+                                   _test_for_each_permutation_detail::count{&calls});
+        BOOST_HANA_RUNTIME_CHECK(calls == 120);
+    }
+
+    // the elements are passed by reference
+    {
+        auto xs = MAKE_TUPLE(0, 0, 0);
+        hana::for_each_permutation(xs, _test_for_each_permutation_detail::increment_first{});
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(xs) == 2);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(xs) == 2);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<2>(xs) == 2);
+    }
+
+    // the elements are not moved from, even from an rvalue
+    {
+        auto xs = MAKE_TUPLE(Tracked{0}, Tracked{1});
+        hana::for_each_permutation(std::move(xs), _test_for_each_permutation_detail::check_not_moved{});
+    }
+
+#ifndef MAKE_TUPLE_NO_CONSTEXPR
+    static_assert(_test_for_each_permutation_detail::permutation_sum() == 2 * 111 * 6, "");
+#endif
+}};
+
+#endif // !BOOST_HANA_TEST_AUTO_FOR_EACH_PERMUTATION_HPP
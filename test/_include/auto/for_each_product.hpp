@@ -0,0 +1,162 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HANA_TEST_AUTO_FOR_EACH_PRODUCT_HPP
+#define BOOST_HANA_TEST_AUTO_FOR_EACH_PRODUCT_HPP
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/for_each_product.hpp>
+
+#include "test_case.hpp"
+#include <laws/base.hpp>
+#include <support/tracked.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace _test_for_each_product_detail {
+    // Records each combination as a string, with one character per element.
+    struct record {
+        std::vector<std::string>* seen;
+
+        template <int ...i>
+        void operator()(boost::hana::test::ct_eq<i> const& ...) const
+        { seen->push_back(std::string{static_cast<char>('0' + i)...}); }
+    };
+
+    struct count {
+        int* calls;
+
+        template <typename ...Xs>
+        void operator()(Xs const& ...) const { ++*calls; }
+    };
+
+    struct add_to_first {
+        void operator()(int& x, int y) const { x += y; }
+    };
+
+    struct check_not_moved {
+        void operator()(Tracked const& x, Tracked const& y) const {
+            Tracked a = x, b = y;
+            (void)a; (void)b;
+        }
+    };
+
+    struct sum {
+        int* total;
+
+        constexpr void operator()(int x, int y) const { *total += x * y; }
+    };
+
+    constexpr int product_sum() {
+        int total = 0;
+        boost::hana::for_each_product(
+            MAKE_TUPLE(MAKE_TUPLE(1, 2), MAKE_TUPLE(10, 20, 30)),
+            sum{&total}
+        );
+        return total;
+    }
+}
+
+
+TestCase test_for_each_product{[]{
+    namespace hana = boost::hana;
+    using hana::test::ct_eq;
+    using _test_for_each_product_detail::record;
+    using Seen = std::vector<std::string>;
+
+    // no sequences
+    {
+        int calls = 0;
+        hana::for_each_product(MAKE_TUPLE(), _test_for_each_product_detail::count{&calls});
+        BOOST_HANA_RUNTIME_CHECK(calls == 0);
+    }
+
+    // an empty sequence
+    {
+        int calls = 0;
+        hana::for_each_product(MAKE_TUPLE(MAKE_TUPLE()),
+                               _test_for_each_product_detail::count{&calls});
+        BOOST_HANA_RUNTIME_CHECK(calls == 0);
+
+        hana::for_each_product(MAKE_TUPLE(MAKE_TUPLE(ct_eq<0>{}), MAKE_TUPLE()),
+                               _test_for_each_product_detail::count{&calls});
+        BOOST_HANA_RUNTIME_CHECK(calls == 0);
+
+        hana::for_each_product(MAKE_TUPLE(MAKE_TUPLE(), MAKE_TUPLE(ct_eq<0>{})),
+                               _test_for_each_product_detail::count{&calls});
+        BOOST_HANA_RUNTIME_CHECK(calls == 0);
+    }
+
+    // 1 sequence
+    {
+        Seen seen;
+        hana::for_each_product(MAKE_TUPLE(MAKE_TUPLE(ct_eq<0>{})), record{&seen});
+        BOOST_HANA_RUNTIME_CHECK(seen == Seen{"0"});
+    }{
+        Seen seen;
+        hana::for_each_product(MAKE_TUPLE(MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})),
+                               record{&seen});
+        BOOST_HANA_RUNTIME_CHECK(seen == (Seen{"0", "1", "2"}));
+    }
+
+    // 2 sequences
+    {
+        Seen seen;
+        hana::for_each_product(MAKE_TUPLE(
+            MAKE_TUPLE(ct_eq<0>{}),
+            MAKE_TUPLE(ct_eq<1>{})
+        ), record{&seen});
+        BOOST_HANA_RUNTIME_CHECK(seen == Seen{"01"});
+    }{
+        Seen seen;
+        hana::for_each_product(MAKE_TUPLE(
+            MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}),
+            MAKE_TUPLE(ct_eq<2>{}, ct_eq<3>{}, ct_eq<4>{})
+        ), record{&seen});
+        BOOST_HANA_RUNTIME_CHECK(seen == (Seen{"02", "03", "04", "12", "13", "14"}));
+    }
+
+    // 3 sequences
+    {
+        Seen seen;
+        hana::for_each_product(MAKE_TUPLE(
+            MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}),
+            MAKE_TUPLE(ct_eq<2>{}),
+            MAKE_TUPLE(ct_eq<3>{}, ct_eq<4>{})
+        ), record{&seen});
+        BOOST_HANA_RUNTIME_CHECK(seen == (Seen{"023", "024", "123", "124"}));
+    }{
+        int calls = 0;
+        hana::for_each_product(MAKE_TUPLE(
+            MAKE_TUPLE(1, 2, 3, 4, 5, 6),
+            MAKE_TUPLE('a', 'b', 'c', 'd'),
+            MAKE_TUPLE(1.0, 2.0f, 3u)
+        ), _test_for_each_product_detail::count{&calls});
+        BOOST_HANA_RUNTIME_CHECK(calls == 6 * 4 * 3);
+    }
+
+    // the elements are passed by reference
+    {
+        auto xs = MAKE_TUPLE(MAKE_TUPLE(0, 100), MAKE_TUPLE(1, 2, 3));
+        hana::for_each_product(xs, _test_for_each_product_detail::add_to_first{});
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(hana::at_c<0>(xs)) == 6);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(hana::at_c<0>(xs)) == 106);
+    }
+
+    // the elements are not moved from, even from an rvalue
+    {
+        auto xs = MAKE_TUPLE(MAKE_TUPLE(Tracked{0}, Tracked{1}), MAKE_TUPLE(Tracked{2}, Tracked{3}));
+        hana::for_each_product(std::move(xs), _test_for_each_product_detail::check_not_moved{});
+    }
+
+#ifndef MAKE_TUPLE_NO_CONSTEXPR
+    static_assert(_test_for_each_product_detail::product_sum() == 3 * 60, "");
+#endif
+}};
+
+#endif // !BOOST_HANA_TEST_AUTO_FOR_EACH_PRODUCT_HPP
@@ -0,0 +1,129 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HANA_TEST_AUTO_NTH_PERMUTATION_HPP
+#define BOOST_HANA_TEST_AUTO_NTH_PERMUTATION_HPP
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/nth_permutation.hpp>
+
+#include "test_case.hpp"
+#include <laws/base.hpp>
+#include <support/tracked.hpp>
+
+#include <utility>
+
+
+TestCase test_nth_permutation{[]{
+    namespace hana = boost::hana;
+    using hana::test::ct_eq;
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::nth_permutation(MAKE_TUPLE(), hana::size_c<0>),
+        MAKE_TUPLE()
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::nth_permutation(MAKE_TUPLE(ct_eq<0>{}), hana::size_c<0>),
+        MAKE_TUPLE(ct_eq<0>{})
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::nth_permutation(MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}), hana::size_c<0>),
+        MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::nth_permutation(MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}), hana::size_c<1>),
+        MAKE_TUPLE(ct_eq<1>{}, ct_eq<0>{})
+    ));
+
+    {
+        auto xs = MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::nth_permutation(xs, hana::size_c<0>),
+            MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::nth_permutation(xs, hana::size_c<1>),
+            MAKE_TUPLE(ct_eq<0>{}, ct_eq<2>{}, ct_eq<1>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::nth_permutation(xs, hana::size_c<2>),
+            MAKE_TUPLE(ct_eq<1>{}, ct_eq<0>{}, ct_eq<2>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::nth_permutation(xs, hana::size_c<3>),
+            MAKE_TUPLE(ct_eq<1>{}, ct_eq<2>{}, ct_eq<0>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::nth_permutation(xs, hana::size_c<4>),
+            MAKE_TUPLE(ct_eq<2>{}, ct_eq<0>{}, ct_eq<1>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::nth_permutation(xs, hana::size_c<5>),
+            MAKE_TUPLE(ct_eq<2>{}, ct_eq<1>{}, ct_eq<0>{})
+        ));
+    }
+
+    // larger sequences, where the digits of n in the factorial number
+    // system are not all 0 or 1
+    {
+        auto xs = MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::nth_permutation(xs, hana::size_c<9>),
+            MAKE_TUPLE(ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{}, ct_eq<0>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::nth_permutation(xs, hana::size_c<23>),
+            MAKE_TUPLE(ct_eq<3>{}, ct_eq<2>{}, ct_eq<1>{}, ct_eq<0>{})
+        ));
+    }{
+        auto xs = MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{},
+                             ct_eq<4>{}, ct_eq<5>{}, ct_eq<6>{});
+        // 3095 = 4 * 6! + 1 * 5! + 3 * 4! + 3 * 3! + 2 * 2! + 1 * 1!
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::nth_permutation(xs, hana::size_c<3095>),
+            MAKE_TUPLE(ct_eq<4>{}, ct_eq<1>{}, ct_eq<5>{}, ct_eq<6>{},
+                       ct_eq<3>{}, ct_eq<2>{}, ct_eq<0>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::nth_permutation(xs, hana::size_c<5039>),
+            MAKE_TUPLE(ct_eq<6>{}, ct_eq<5>{}, ct_eq<4>{}, ct_eq<3>{},
+                       ct_eq<2>{}, ct_eq<1>{}, ct_eq<0>{})
+        ));
+    }
+
+    // nth_permutation_c
+    {
+        auto xs = MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::nth_permutation_c<3>(xs),
+            hana::nth_permutation(xs, hana::size_c<3>)
+        ));
+    }
+
+    // the elements are moved from an rvalue sequence
+    {
+        auto xs = MAKE_TUPLE(Tracked{0}, Tracked{1}, Tracked{2});
+        auto ys = hana::nth_permutation_c<4>(std::move(xs));
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(ys).value == 2);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(ys).value == 0);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<2>(ys).value == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(xs).state == Tracked::State::MOVED_FROM);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(xs).state == Tracked::State::MOVED_FROM);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<2>(xs).state == Tracked::State::MOVED_FROM);
+    }
+
+#ifndef MAKE_TUPLE_NO_CONSTEXPR
+    static_assert(hana::equal(
+        hana::nth_permutation_c<3>(MAKE_TUPLE(1, '2', 3.0)),
+        MAKE_TUPLE('2', 3.0, 1)
+    ), "");
+#endif
+}};
+
+#endif // !BOOST_HANA_TEST_AUTO_NTH_PERMUTATION_HPP
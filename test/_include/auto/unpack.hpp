@@ -0,0 +1,92 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HANA_TEST_AUTO_UNPACK_HPP
+#define BOOST_HANA_TEST_AUTO_UNPACK_HPP
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include "test_case.hpp"
+#include <laws/base.hpp>
+
+#include <type_traits>
+#include <utility>
+
+
+namespace _test_unpack_detail {
+    // Returns whether each argument was passed as an rvalue.
+    struct rvalues {
+        template <typename ...X>
+        constexpr auto operator()(X&& ...) const {
+            return boost::hana::make_tuple(
+                boost::hana::bool_c<std::is_rvalue_reference<X&&>::value>...
+            );
+        }
+    };
+}
+
+TestCase test_unpack{[] {
+    namespace hana = boost::hana;
+    using hana::test::ct_eq;
+    hana::test::_injection<0> f{};
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unpack(MAKE_TUPLE(), f),
+        f()
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unpack(MAKE_TUPLE(ct_eq<0>{}), f),
+        f(ct_eq<0>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unpack(MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}), f),
+        f(ct_eq<0>{}, ct_eq<1>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unpack(MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}), f),
+        f(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unpack(MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{}, ct_eq<4>{}), f),
+        f(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{}, ct_eq<4>{})
+    ));
+
+    // the elements are forwarded with the value category of the sequence
+    {
+        auto xs = MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto const& cxs = xs;
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(xs, _test_unpack_detail::rvalues{}),
+            hana::make_tuple(hana::false_c, hana::false_c, hana::false_c)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(cxs, _test_unpack_detail::rvalues{}),
+            hana::make_tuple(hana::false_c, hana::false_c, hana::false_c)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(std::move(xs), _test_unpack_detail::rvalues{}),
+            hana::make_tuple(hana::true_c, hana::true_c, hana::true_c)
+        ));
+    }
+
+#ifndef MAKE_TUPLE_NO_CONSTEXPR
+    struct sum {
+        constexpr int operator()() const { return 0; }
+        constexpr int operator()(int a) const { return a; }
+        constexpr int operator()(int a, int b) const { return a + b; }
+        constexpr int operator()(int a, int b, int c) const { return a + b + c; }
+    };
+
+    static_assert(hana::unpack(MAKE_TUPLE(), sum{}) == 0, "");
+    static_assert(hana::unpack(MAKE_TUPLE(1), sum{}) == 1, "");
+    static_assert(hana::unpack(MAKE_TUPLE(1, 2), sum{}) == 3, "");
+    static_assert(hana::unpack(MAKE_TUPLE(1, 2, 3), sum{}) == 6, "");
+#endif
+}};
+
+#endif // !BOOST_HANA_TEST_AUTO_UNPACK_HPP
@@ -0,0 +1,107 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HANA_TEST_AUTO_VISIT_AT_HPP
+#define BOOST_HANA_TEST_AUTO_VISIT_AT_HPP
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/visit_at.hpp>
+
+#include "test_case.hpp"
+#include <laws/base.hpp>
+#include <support/tracked.hpp>
+
+#include <cstddef>
+#include <utility>
+
+
+namespace _test_visit_at_detail {
+    struct index_of {
+        template <int i>
+        constexpr int operator()(boost::hana::test::ct_eq<i> const&) const
+        { return i; }
+
+        int operator()(Tracked const&) const { return -1; }
+    };
+
+    struct identity {
+        template <typename T>
+        constexpr T operator()(T const& t) const { return t; }
+    };
+
+    struct as_double {
+        template <typename T>
+        constexpr double operator()(T const& t) const { return t; }
+    };
+
+    struct assign {
+        template <typename T>
+        constexpr T& operator()(T& t) const { t = 42; return t; }
+    };
+}
+
+
+TestCase test_visit_at{[]{
+    namespace hana = boost::hana;
+    using hana::test::ct_eq;
+    using _test_visit_at_detail::index_of;
+
+    {
+        auto xs = MAKE_TUPLE(ct_eq<0>{});
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, 0, index_of{}) == 0);
+    }
+    {
+        auto xs = MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{});
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, 0, index_of{}) == 0);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, 1, index_of{}) == 1);
+    }
+    {
+        auto xs = MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{},
+                             ct_eq<4>{}, ct_eq<5>{}, ct_eq<6>{}, ct_eq<7>{});
+        for (std::size_t n = 0; n != 8; ++n)
+            BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, n, index_of{}) == static_cast<int>(n));
+    }
+
+    // the index may also be a Constant
+    {
+        auto xs = MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, hana::size_c<2>, index_of{}) == 2);
+    }
+
+    // the result is that of visiting the first element
+    {
+        auto xs = MAKE_TUPLE(1, 2.5f, '3');
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, 0, _test_visit_at_detail::as_double{}) == 1.0);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, 1, _test_visit_at_detail::as_double{}) == 2.5);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, 2, _test_visit_at_detail::as_double{}) == '3');
+    }
+
+    // elements are passed with the value category of the sequence
+    {
+        auto xs = MAKE_TUPLE(1, 2, 3);
+        int& two = hana::visit_at(xs, 1, _test_visit_at_detail::assign{});
+        BOOST_HANA_RUNTIME_CHECK(&two == &hana::at_c<1>(xs));
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(xs) == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(xs) == 42);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<2>(xs) == 3);
+    }
+
+#ifndef MAKE_TUPLE_NO_CONSTEXPR
+    static_assert(hana::visit_at(MAKE_TUPLE(1), 0, _test_visit_at_detail::identity{}) == 1, "");
+    static_assert(hana::visit_at(MAKE_TUPLE(1, 2), 1, _test_visit_at_detail::identity{}) == 2, "");
+    static_assert(hana::visit_at(MAKE_TUPLE(1, 2, 3), 2, _test_visit_at_detail::identity{}) == 3, "");
+#endif
+
+    // make sure we can use non-pods
+    {
+        auto xs = MAKE_TUPLE(Tracked{0}, ct_eq<1>{}, Tracked{2});
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, 0, index_of{}) == -1);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, 1, index_of{}) == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(std::move(xs), 2, index_of{}) == -1);
+    }
+}};
+
+#endif // !BOOST_HANA_TEST_AUTO_VISIT_AT_HPP
@@ -0,0 +1,98 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/adapt_adt.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (int, x),
+        (int, y)
+    );
+};
+
+struct Counter {
+    int count;
+};
+
+// The accessors of this Struct hold a state, so they can't be
+// default-constructed.
+struct stateful_accessor {
+    int offset;
+    constexpr int operator()(Counter const& c) const { return c.count + offset; }
+};
+
+BOOST_HANA_NAMESPACE_BEGIN
+    template <>
+    struct accessors_impl<Counter> {
+        static constexpr auto apply() {
+            return hana::make_tuple(
+                hana::make_pair(hana::string_c<'o', 'n', 'e'>, stateful_accessor{1}),
+                hana::make_pair(hana::string_c<'t', 'w', 'o'>, stateful_accessor{2})
+            );
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+struct Wrapper {
+    int value() const { return i; }
+    int i;
+};
+
+BOOST_HANA_ADAPT_ADT(Wrapper,
+    (value, [](auto const& w) { return w.value(); })
+);
+
+int main() {
+    // The accessors built by the macros are usable in constant expressions,
+    // and they are the same every time.
+    {
+        constexpr Point p{1, 2};
+        static_assert(hana::second(hana::at_c<0>(hana::accessors<Point>()))(p) == 1, "");
+        static_assert(hana::second(hana::at_c<1>(hana::accessors<Point>()))(p) == 2, "");
+        static_assert(std::is_same<
+            decltype(hana::accessors<Point>()),
+            decltype(hana::accessors<Point>())
+        >{}, "");
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::keys(p),
+            hana::make_tuple(BOOST_HANA_STRING("x"), BOOST_HANA_STRING("y"))
+        ));
+    }
+
+    // Accessors with a state are obtained from `accessors_impl::apply()`.
+    {
+        constexpr Counter c{10};
+        static_assert(hana::second(hana::at_c<0>(hana::accessors<Counter>()))(c) == 11, "");
+        static_assert(hana::second(hana::at_c<1>(hana::accessors<Counter>()))(c) == 12, "");
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::keys(c),
+            hana::make_tuple(BOOST_HANA_STRING("one"), BOOST_HANA_STRING("two"))
+        ));
+    }
+
+    // So are accessors made of lambdas.
+    {
+        Wrapper w{3};
+        BOOST_HANA_RUNTIME_CHECK(hana::second(hana::at_c<0>(hana::accessors<Wrapper>()))(w) == 3);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::first(hana::at_c<0>(hana::accessors<Wrapper>())),
+            BOOST_HANA_STRING("value")
+        ));
+    }
+}
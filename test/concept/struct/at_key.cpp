@@ -5,10 +5,16 @@
 #include <boost/hana/assert.hpp>
 #include <boost/hana/at_key.hpp>
 #include <boost/hana/define_struct.hpp>
+#include <boost/hana/pair.hpp>
 #include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
 
 #include <string>
+#include <utility>
 namespace hana = boost::hana;
+using hana::test::ct_eq;
 
 
 struct Person {
@@ -19,6 +25,28 @@ struct Person {
     );
 };
 
+// A Struct whose keys are not Hashable, which can't be looked up with a
+// hash table.
+struct Point {
+    int x, y;
+};
+
+namespace boost { namespace hana {
+    template <>
+    struct accessors_impl<Point> {
+        static auto apply() {
+            return hana::make_tuple(
+                hana::make_pair(ct_eq<0>{}, [](auto&& p) -> decltype(auto) {
+                    return (static_cast<decltype(p)&&>(p).x);
+                }),
+                hana::make_pair(ct_eq<1>{}, [](auto&& p) -> decltype(auto) {
+                    return (static_cast<decltype(p)&&>(p).y);
+                })
+            );
+        }
+    };
+}}
+
 int main() {
     // non-const ref
     {
@@ -52,4 +80,20 @@ int main() {
         BOOST_HANA_RUNTIME_CHECK(last_name == "Foo");
         BOOST_HANA_RUNTIME_CHECK(age == 99);
     }
+
+    // rvalue
+    {
+        Person john{"John", "Doe", 30};
+        std::string&& name = hana::at_key(std::move(john), BOOST_HANA_STRING("name"));
+        BOOST_HANA_RUNTIME_CHECK(&name == &john.name);
+    }
+
+    // keys that are not Hashable
+    {
+        Point p{1, 2};
+        int& x = hana::at_key(p, ct_eq<0>{});
+        int& y = hana::at_key(p, ct_eq<1>{});
+        BOOST_HANA_RUNTIME_CHECK(&x == &p.x);
+        BOOST_HANA_RUNTIME_CHECK(&y == &p.y);
+    }
 }
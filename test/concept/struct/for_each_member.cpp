@@ -0,0 +1,104 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/if.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/members.hpp>
+#include <boost/hana/string.hpp>
+
+#include "minimal_struct.hpp"
+#include <laws/base.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (std::string, city),
+        (int, age)
+    );
+};
+
+int main() {
+    // with no members, the function is never called
+    hana::for_each_member(obj(), [](auto&&, auto&&) {
+        BOOST_HANA_RUNTIME_CHECK(false);
+    });
+
+    // the names and the members are passed in order
+    {
+        std::vector<int> seen;
+        hana::for_each_member(obj(ct_eq<10>{}, ct_eq<11>{}, ct_eq<12>{}),
+        [&](auto name, auto member) {
+            BOOST_HANA_CONSTANT_CHECK(hana::equal(
+                ct_eq<decltype(name)::value + 10>{},
+                member
+            ));
+            seen.push_back(decltype(name)::value);
+        });
+        BOOST_HANA_RUNTIME_CHECK(seen == std::vector<int>{0, 1, 2});
+    }
+
+    // the names are the ones given to the members
+    {
+        std::vector<std::string> names;
+        hana::for_each_member(Person{"John", "Montreal", 30},
+        [&](auto name, auto&&) {
+            names.push_back(hana::to<char const*>(name));
+        });
+        BOOST_HANA_RUNTIME_CHECK(names == std::vector<std::string>{"name", "city", "age"});
+    }
+
+    // make sure the members are passed by reference to the original object
+    {
+        Person john{"John", "Montreal", 30};
+        std::vector<void const*> addresses;
+        hana::for_each_member(john, [&](auto, auto& member) {
+            static_assert(!std::is_const<
+                std::remove_reference_t<decltype(member)>
+            >{}, "");
+            addresses.push_back(&member);
+        });
+        BOOST_HANA_RUNTIME_CHECK(addresses == std::vector<void const*>{
+            &john.name, &john.city, &john.age
+        });
+
+        Person const& cjohn = john;
+        addresses.clear();
+        hana::for_each_member(cjohn, [&](auto, auto& member) {
+            static_assert(std::is_const<
+                std::remove_reference_t<decltype(member)>
+            >{}, "");
+            addresses.push_back(&member);
+        });
+        BOOST_HANA_RUNTIME_CHECK(addresses == std::vector<void const*>{
+            &john.name, &john.city, &john.age
+        });
+    }
+
+    // make sure the value category of the object is preserved
+    {
+        Person john{"John", "Montreal", 30};
+        std::vector<std::string> stolen;
+        hana::for_each_member(std::move(john), [&](auto, auto&& member) {
+            static_assert(std::is_rvalue_reference<decltype(member)>{}, "");
+            stolen.push_back(hana::if_(
+                std::is_same<std::decay_t<decltype(member)>, std::string>{},
+                [](auto&& s) { return std::string(std::move(s)); },
+                [](auto&& i) { return std::to_string(i); }
+            )(std::move(member)));
+        });
+        BOOST_HANA_RUNTIME_CHECK(stolen == std::vector<std::string>{"John", "Montreal", "30"});
+    }
+}
@@ -0,0 +1,112 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/adapt_adt.hpp>
+#include <boost/hana/adapt_struct.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+// The struct macros do not depend on the number of members, so we make
+// sure they can handle a number of members much larger than what could
+// be handled when they were generated for each arity. To keep this test
+// reasonably fast, only BOOST_HANA_DEFINE_STRUCT is used with 300 members.
+
+#define DECLARE_10(p) \
+    int p##0, p##1, p##2, p##3, p##4, p##5, p##6, p##7, p##8, p##9;
+
+#define DECLARE_100(p) \
+    DECLARE_10(p##0) DECLARE_10(p##1) DECLARE_10(p##2) DECLARE_10(p##3) \
+    DECLARE_10(p##4) DECLARE_10(p##5) DECLARE_10(p##6) DECLARE_10(p##7) \
+    DECLARE_10(p##8) DECLARE_10(p##9)
+
+#define NAMES_10(p) p##0, p##1, p##2, p##3, p##4, p##5, p##6, p##7, p##8, p##9
+
+#define NAMES_100(p)                                                        \
+    NAMES_10(p##0), NAMES_10(p##1), NAMES_10(p##2), NAMES_10(p##3),         \
+    NAMES_10(p##4), NAMES_10(p##5), NAMES_10(p##6), NAMES_10(p##7),         \
+    NAMES_10(p##8), NAMES_10(p##9)
+
+#define MEMBERS_10(p)                                                       \
+    (int, p##0), (int, p##1), (int, p##2), (int, p##3), (int, p##4),        \
+    (int, p##5), (int, p##6), (int, p##7), (int, p##8), (int, p##9)
+
+#define MEMBERS_100(p)                                                      \
+    MEMBERS_10(p##0), MEMBERS_10(p##1), MEMBERS_10(p##2), MEMBERS_10(p##3), \
+    MEMBERS_10(p##4), MEMBERS_10(p##5), MEMBERS_10(p##6), MEMBERS_10(p##7), \
+    MEMBERS_10(p##8), MEMBERS_10(p##9)
+
+#define GETTERS_10(p)                                                       \
+    (p##0, [](auto const& x) { return x.p##0; }),                           \
+    (p##1, [](auto const& x) { return x.p##1; }),                           \
+    (p##2, [](auto const& x) { return x.p##2; }),                           \
+    (p##3, [](auto const& x) { return x.p##3; }),                           \
+    (p##4, [](auto const& x) { return x.p##4; }),                           \
+    (p##5, [](auto const& x) { return x.p##5; }),                           \
+    (p##6, [](auto const& x) { return x.p##6; }),                           \
+    (p##7, [](auto const& x) { return x.p##7; }),                           \
+    (p##8, [](auto const& x) { return x.p##8; }),                           \
+    (p##9, [](auto const& x) { return x.p##9; })
+
+#define GETTERS_100(p)                                                      \
+    GETTERS_10(p##0), GETTERS_10(p##1), GETTERS_10(p##2), GETTERS_10(p##3), \
+    GETTERS_10(p##4), GETTERS_10(p##5), GETTERS_10(p##6), GETTERS_10(p##7), \
+    GETTERS_10(p##8), GETTERS_10(p##9)
+
+namespace ns {
+    struct Defined {
+        BOOST_HANA_DEFINE_STRUCT(Defined,
+            MEMBERS_100(a), MEMBERS_100(b), MEMBERS_100(c)
+        );
+    };
+
+    struct Adapted {
+        DECLARE_100(a)
+    };
+
+    struct AdaptedADT {
+        DECLARE_100(a)
+    };
+}
+
+BOOST_HANA_ADAPT_STRUCT(ns::Adapted, NAMES_100(a));
+
+BOOST_HANA_ADAPT_ADT(ns::AdaptedADT, GETTERS_100(a));
+
+static_assert(hana::Struct<ns::Defined>::value, "");
+static_assert(hana::Struct<ns::Adapted>::value, "");
+static_assert(hana::Struct<ns::AdaptedADT>::value, "");
+
+int main() {
+    {
+        static_assert(decltype(hana::length(hana::keys(ns::Defined{})))::value == 300, "");
+        ns::Defined t{};
+        t.a00 = 1;
+        t.c99 = 2;
+        BOOST_HANA_RUNTIME_CHECK(&hana::at_key(t, BOOST_HANA_STRING("a00")) == &t.a00);
+        BOOST_HANA_RUNTIME_CHECK(&hana::at_key(t, BOOST_HANA_STRING("c99")) == &t.c99);
+    }
+
+    {
+        static_assert(decltype(hana::length(hana::keys(ns::Adapted{})))::value == 100, "");
+        ns::Adapted t{};
+        BOOST_HANA_RUNTIME_CHECK(&hana::at_key(t, BOOST_HANA_STRING("a00")) == &t.a00);
+        BOOST_HANA_RUNTIME_CHECK(&hana::at_key(t, BOOST_HANA_STRING("a99")) == &t.a99);
+    }
+
+    {
+        static_assert(decltype(hana::length(hana::keys(ns::AdaptedADT{})))::value == 100, "");
+        ns::AdaptedADT t{};
+        t.a00 = 1;
+        t.a99 = 2;
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(t, BOOST_HANA_STRING("a00")) == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(t, BOOST_HANA_STRING("a99")) == 2);
+    }
+}
@@ -0,0 +1,101 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/members.hpp>
+
+#include "minimal_struct.hpp"
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+
+#include <string>
+#include <utility>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+struct MoveOnly {
+    MoveOnly()                           = default;
+    MoveOnly(MoveOnly&&)                 = default;
+    MoveOnly(MoveOnly const&)            = delete;
+    MoveOnly& operator=(MoveOnly&&)      = default;
+    MoveOnly& operator=(MoveOnly const&) = delete;
+};
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (int, age)
+    );
+};
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unpack_members(obj(), ::seq),
+        ::seq()
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unpack_members(obj(ct_eq<0>{}), ::seq),
+        ::seq(ct_eq<0>{})
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unpack_members(obj(ct_eq<0>{}, ct_eq<1>{}), ::seq),
+        ::seq(ct_eq<0>{}, ct_eq<1>{})
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unpack_members(obj(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}), ::seq),
+        ::seq(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})
+    ));
+
+    // make sure the members are passed by reference to the original object
+    {
+        Person john{"John", 30};
+        hana::unpack_members(john, [&](std::string& name, int& age) {
+            BOOST_HANA_RUNTIME_CHECK(&name == &john.name);
+            BOOST_HANA_RUNTIME_CHECK(&age == &john.age);
+        });
+
+        Person const& cjohn = john;
+        hana::unpack_members(cjohn, [&](std::string const& name, int const& age) {
+            BOOST_HANA_RUNTIME_CHECK(&name == &john.name);
+            BOOST_HANA_RUNTIME_CHECK(&age == &john.age);
+        });
+    }
+
+    // make sure the value category of the object is preserved
+    {
+        Person john{"John", 30};
+        hana::unpack_members(std::move(john), [&](std::string&& name, int&& age) {
+            BOOST_HANA_RUNTIME_CHECK(&name == &john.name);
+            BOOST_HANA_RUNTIME_CHECK(&age == &john.age);
+            std::string stolen = std::move(name);
+            BOOST_HANA_RUNTIME_CHECK(stolen == "John");
+        });
+    }
+
+    // make sure the result of the function is returned as-is
+    {
+        Person john{"John", 30};
+        std::string& name = hana::unpack_members(john,
+            [](std::string& name, int&) -> std::string& { return name; });
+        BOOST_HANA_RUNTIME_CHECK(&name == &john.name);
+    }
+
+    // make sure it works with move only types
+    {
+        auto o = obj(MoveOnly{}, MoveOnly{});
+        hana::unpack_members(std::move(o), [](MoveOnly&& x, MoveOnly&& y) {
+            MoveOnly z1{std::move(x)};
+            MoveOnly z2{std::move(y)};
+            (void)z1;
+            (void)z2;
+        });
+    }
+}
@@ -3,10 +3,35 @@
 // (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
 
 #include <boost/hana/detail/has_duplicates.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/hash.hpp>
 #include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
 namespace hana = boost::hana;
 
 
+// Distinct keys whose hashes collide
+template <int i>
+struct x { };
+
+struct the_hash;
+
+namespace boost { namespace hana {
+    template <int i>
+    struct hash_impl<x<i>> {
+        static constexpr auto apply(x<i> const&)
+        { return hana::type_c<the_hash>; }
+    };
+
+    template <int i, int j>
+    struct equal_impl<x<i>, x<j>> {
+        static constexpr auto apply(x<i> const&, x<j> const&)
+        { return hana::bool_c<i == j>; }
+    };
+}}
+
+
 static_assert(!hana::detail::has_duplicates<>::value, "");
 
 static_assert(!hana::detail::has_duplicates<
@@ -54,4 +79,34 @@ static_assert(hana::detail::has_duplicates<
     hana::int_<0>, hana::int_<1>, hana::int_<2>, hana::long_<1>
 >::value, "");
 
+// Make sure it handles keys with colliding hashes
+static_assert(!hana::detail::has_duplicates<
+    x<0>, x<1>, x<2>
+>::value, "");
+
+static_assert(!hana::detail::has_duplicates<
+    x<0>, hana::int_<0>, x<1>, hana::int_<1>
+>::value, "");
+
+static_assert(hana::detail::has_duplicates<
+    x<0>, x<1>, x<2>, x<1>
+>::value, "");
+
+static_assert(hana::detail::has_duplicates<
+    x<0>, hana::int_<0>, x<1>, hana::int_<0>
+>::value, "");
+
+// Make sure it works with keys that are not Hashable
+static_assert(!hana::detail::has_duplicates<
+    hana::tuple<hana::int_<0>>, hana::tuple<hana::int_<1>>
+>::value, "");
+
+static_assert(hana::detail::has_duplicates<
+    hana::tuple<hana::int_<0>>, hana::tuple<hana::int_<1>>, hana::tuple<hana::long_<0>>
+>::value, "");
+
+static_assert(hana::detail::has_duplicates<
+    hana::int_<0>, hana::tuple<hana::int_<1>>, hana::long_<0>
+>::value, "");
+
 int main() { }
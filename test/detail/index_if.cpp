@@ -5,6 +5,9 @@
 #include <boost/hana/detail/index_if.hpp>
 
 #include <boost/hana/bool.hpp>
+
+#include <cstddef>
+#include <utility>
 namespace hana = boost::hana;
 
 
@@ -26,6 +29,14 @@ struct NotFound {
 
 struct Undefined;
 
+template <typename Indices>
+struct make_pack_of_x;
+
+template <std::size_t ...i>
+struct make_pack_of_x<std::index_sequence<i...>> {
+    using type = hana::detail::pack<x<static_cast<int>(i)>...>;
+};
+
 int main() {
     {
         using Pack = hana::detail::pack<>;
@@ -71,4 +82,12 @@ int main() {
         static_assert(hana::detail::index_if<Find<4>, Pack>::value == 4, "");
         static_assert(hana::detail::index_if<NotFound, Pack>::value == 5, "");
     }
+
+    // Make sure the instantiation depth does not grow with the size of the pack
+    {
+        using Pack = make_pack_of_x<std::make_index_sequence<2000>>::type;
+        static_assert(hana::detail::index_if<Find<0>, Pack>::value == 0, "");
+        static_assert(hana::detail::index_if<Find<1999>, Pack>::value == 1999, "");
+        static_assert(hana::detail::index_if<NotFound, Pack>::value == 2000, "");
+    }
 }
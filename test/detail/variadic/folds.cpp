@@ -0,0 +1,91 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/detail/variadic/foldl1.hpp>
+#include <boost/hana/detail/variadic/foldr1.hpp>
+
+#include <boost/hana/assert.hpp>
+
+#include <type_traits>
+#include <utility>
+namespace hana = boost::hana;
+using hana::detail::variadic::foldl1;
+using hana::detail::variadic::foldr1;
+using hana::detail::variadic::foldr;
+
+
+struct minus {
+    template <typename X, typename Y>
+    constexpr long operator()(X x, Y y) const { return x - y; }
+};
+
+struct left {
+    template <typename X, typename Y>
+    constexpr X&& operator()(X&& x, Y&&) const { return static_cast<X&&>(x); }
+};
+
+struct right {
+    template <typename X, typename Y>
+    constexpr Y&& operator()(X&&, Y&& y) const { return static_cast<Y&&>(y); }
+};
+
+template <std::size_t ...i>
+constexpr long foldl1_long(std::index_sequence<i...>)
+{ return foldl1(minus{}, static_cast<long>(i)...); }
+
+template <std::size_t ...i>
+constexpr long foldr1_long(std::index_sequence<i...>)
+{ return foldr1(minus{}, static_cast<long>(i)...); }
+
+template <std::size_t ...i>
+constexpr long foldr_long(std::index_sequence<i...>)
+{ return foldr(minus{}, 0l, static_cast<long>(i)...); }
+
+int main() {
+    // long folds
+    {
+        // 0 - 1 - 2 - ... - 999
+        static_assert(foldl1_long(std::make_index_sequence<1000>{}) == -499500, "");
+
+        // 0 - (1 - (2 - ... - (998 - 999)))
+        static_assert(foldr1_long(std::make_index_sequence<1000>{}) == -500, "");
+
+        // 0 - (1 - (2 - ... - (999 - 0)))
+        static_assert(foldr_long(std::make_index_sequence<1000>{}) == -500, "");
+    }
+
+    // references returned by the function are preserved
+    {
+        int a = 0, b = 1, c = 2, d = 3;
+
+        int& l = foldl1(left{}, a, b, c, d);
+        BOOST_HANA_RUNTIME_CHECK(&l == &a);
+        int& r = foldl1(right{}, a, b, c, d);
+        BOOST_HANA_RUNTIME_CHECK(&r == &d);
+
+        int& l2 = foldr1(left{}, a, b, c, d);
+        BOOST_HANA_RUNTIME_CHECK(&l2 == &a);
+        int& r2 = foldr1(right{}, a, b, c, d);
+        BOOST_HANA_RUNTIME_CHECK(&r2 == &d);
+
+        int& s = foldr(right{}, d, a, b, c);
+        BOOST_HANA_RUNTIME_CHECK(&s == &d);
+
+        static_assert(std::is_same<decltype(foldl1(left{}, a)), int&>{}, "");
+        static_assert(std::is_same<decltype(foldl1(left{}, 1)), int>{}, "");
+        static_assert(std::is_same<decltype(foldr1(left{}, a)), int&>{}, "");
+        static_assert(std::is_same<decltype(foldr(left{}, a)), int&>{}, "");
+        static_assert(std::is_same<decltype(foldl1(left{}, 1, a, b)), int&&>{}, "");
+    }
+
+    // the function may return void when it is called only once
+    {
+        int calls = 0;
+        auto f = [&](int, int) { ++calls; };
+        foldl1(f, 1, 2);
+        foldr1(f, 1, 2);
+        foldr(f, 1, 2);
+        BOOST_HANA_RUNTIME_CHECK(calls == 3);
+    }
+}
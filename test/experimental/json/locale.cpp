@@ -0,0 +1,58 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/json.hpp>
+
+#include <clocale>
+#include <iterator>
+#include <string>
+namespace hana = boost::hana;
+
+
+// Numbers must be written and parsed with a '.' as the decimal point, even
+// when the current C locale uses another one. The test is skipped when no
+// such locale is available.
+int main() {
+    char const* locales[] = {"de_DE.UTF-8", "de_DE.utf8", "de_DE",
+                             "fr_FR.UTF-8", "fr_FR.utf8", "fr_FR"};
+    bool found = false;
+    for (char const* name : locales) {
+        if (std::setlocale(LC_NUMERIC, name)) {
+            found = true;
+            break;
+        }
+    }
+    if (!found)
+        return 0;
+
+    {
+        std::string result;
+        hana::experimental::to_json(std::back_inserter(result), 1.5);
+        BOOST_HANA_RUNTIME_CHECK(result == "1.5");
+
+        // numbers are read back exactly
+        result.clear();
+        hana::experimental::to_json(std::back_inserter(result), 0.1);
+        BOOST_HANA_RUNTIME_CHECK(result.find(',') == std::string::npos);
+        double x = 0;
+        char const* last = result.data() + result.size();
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::from_json(result.data(), last, x) == last);
+        BOOST_HANA_RUNTIME_CHECK(x == 0.1);
+    }
+
+    {
+        std::string json = "-2.25e3";
+        double x = 0;
+        char const* last = json.data() + json.size();
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::from_json(json.data(), last, x) == last);
+        BOOST_HANA_RUNTIME_CHECK(x == -2250.0);
+
+        json = "1,5";
+        last = json.data() + json.size();
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::from_json(json.data(), last, x) != last);
+    }
+
+    std::setlocale(LC_NUMERIC, "C");
+}
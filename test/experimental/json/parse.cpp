@@ -0,0 +1,173 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/json.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <string>
+namespace hana = boost::hana;
+
+
+// Returns whether the whole string was parsed successfully into `x`.
+template <typename T>
+bool from_json(std::string const& json, T& x) {
+    char const* first = json.data();
+    char const* last = first + json.size();
+    return hana::experimental::from_json(first, last, x) == last;
+}
+
+template <typename T>
+T parse(std::string const& json) {
+    T x{};
+    BOOST_HANA_RUNTIME_CHECK(from_json(json, x));
+    return x;
+}
+
+template <typename T>
+bool fails(std::string const& json) {
+    T x{};
+    char const* first = json.data();
+    return hana::experimental::from_json(first, first + json.size(), x) == nullptr;
+}
+
+template <typename T>
+T round_trip(T const& x) {
+    std::string json;
+    hana::experimental::to_json(std::back_inserter(json), x);
+    return parse<T>(json);
+}
+
+struct Empty {
+    BOOST_HANA_DEFINE_STRUCT(Empty);
+};
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (int, age),
+        (bool, married)
+    );
+};
+
+struct Family {
+    BOOST_HANA_DEFINE_STRUCT(Family,
+        (Person, parent),
+        (hana::tuple<Person, Person>, children),
+        (double, income)
+    );
+};
+
+int main() {
+    // bool
+    {
+        BOOST_HANA_RUNTIME_CHECK(parse<bool>("true") == true);
+        BOOST_HANA_RUNTIME_CHECK(parse<bool>(" false") == false);
+        BOOST_HANA_RUNTIME_CHECK(fails<bool>("tru"));
+        BOOST_HANA_RUNTIME_CHECK(fails<bool>("1"));
+    }
+
+    // integers
+    {
+        BOOST_HANA_RUNTIME_CHECK(parse<int>("0") == 0);
+        BOOST_HANA_RUNTIME_CHECK(parse<int>(" -42") == -42);
+        BOOST_HANA_RUNTIME_CHECK(parse<std::int64_t>("-9223372036854775808") == std::numeric_limits<std::int64_t>::min());
+        BOOST_HANA_RUNTIME_CHECK(parse<std::uint64_t>("18446744073709551615") == std::numeric_limits<std::uint64_t>::max());
+        BOOST_HANA_RUNTIME_CHECK(parse<signed char>("-128") == -128);
+        BOOST_HANA_RUNTIME_CHECK(fails<signed char>("128"));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::uint64_t>("18446744073709551616"));
+        BOOST_HANA_RUNTIME_CHECK(fails<unsigned>("-1"));
+        BOOST_HANA_RUNTIME_CHECK(fails<int>("-"));
+        BOOST_HANA_RUNTIME_CHECK(fails<int>(""));
+    }
+
+    // floating point numbers
+    {
+        BOOST_HANA_RUNTIME_CHECK(parse<double>("1.5") == 1.5);
+        BOOST_HANA_RUNTIME_CHECK(parse<double>("-2.5e3") == -2500.0);
+        BOOST_HANA_RUNTIME_CHECK(std::isnan(parse<double>("null")));
+        BOOST_HANA_RUNTIME_CHECK(round_trip(0.1) == 0.1);
+        BOOST_HANA_RUNTIME_CHECK(round_trip(1.0 / 3.0) == 1.0 / 3.0);
+        BOOST_HANA_RUNTIME_CHECK(round_trip(0.1f) == 0.1f);
+        BOOST_HANA_RUNTIME_CHECK(fails<double>("abc"));
+        BOOST_HANA_RUNTIME_CHECK(fails<double>("1e"));
+
+        // numbers longer than the buffer used for most numbers
+        BOOST_HANA_RUNTIME_CHECK(parse<double>("0." + std::string(100, '0') + "15e101") == 1.5);
+        BOOST_HANA_RUNTIME_CHECK(parse<double>("-2." + std::string(200, '0')) == -2.0);
+        BOOST_HANA_RUNTIME_CHECK(parse<hana::tuple<double, int>>("[1" + std::string(70, '0') + "e-70, 3]")
+                                    == hana::make_tuple(1.0, 3));
+        BOOST_HANA_RUNTIME_CHECK(fails<double>("1." + std::string(100, '0') + "e"));
+    }
+
+    // strings
+    {
+        BOOST_HANA_RUNTIME_CHECK(parse<std::string>(R"("")") == "");
+        BOOST_HANA_RUNTIME_CHECK(parse<std::string>(R"( "abc")") == "abc");
+        BOOST_HANA_RUNTIME_CHECK(parse<std::string>(R"("a\"b\\c\/")") == "a\"b\\c/");
+        BOOST_HANA_RUNTIME_CHECK(parse<std::string>(R"("\b\f\n\r\t")") == "\b\f\n\r\t");
+        BOOST_HANA_RUNTIME_CHECK(parse<std::string>(R"("Aé€")") == "A\xc3\xa9\xe2\x82\xac");
+        BOOST_HANA_RUNTIME_CHECK(parse<std::string>(R"("😀")") == "\xf0\x9f\x98\x80");
+        BOOST_HANA_RUNTIME_CHECK(round_trip(std::string{"\x01 \"quoted\" \\ \n"}) == "\x01 \"quoted\" \\ \n");
+        BOOST_HANA_RUNTIME_CHECK(fails<std::string>(R"("abc)"));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::string>(R"("\x")"));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::string>(R"("\u12")"));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::string>(R"("\ud83d")"));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::string>("abc"));
+    }
+
+    // sequences
+    {
+        parse<hana::tuple<>>("[]");
+        parse<hana::tuple<>>("[ ]");
+        auto xs = parse<hana::tuple<int, std::string, bool>>(R"([1, "x" ,true ])");
+        BOOST_HANA_RUNTIME_CHECK(xs == hana::make_tuple(1, std::string{"x"}, true));
+        BOOST_HANA_RUNTIME_CHECK(fails<hana::tuple<int, int>>("[1]"));
+        BOOST_HANA_RUNTIME_CHECK(fails<hana::tuple<int, int>>("[1,2,3]"));
+        BOOST_HANA_RUNTIME_CHECK(fails<hana::tuple<int, int>>("[1 2]"));
+        BOOST_HANA_RUNTIME_CHECK(fails<hana::tuple<int>>("1"));
+    }
+
+    // Structs
+    {
+        parse<Empty>("{}");
+        parse<Empty>(R"({"unknown": [1, {"a": "]}"}]})");
+
+        Person p = parse<Person>(R"({"name":"John","age":30,"married":true})");
+        BOOST_HANA_RUNTIME_CHECK(p.name == "John" && p.age == 30 && p.married);
+
+        // in any order, with whitespace and unknown keys
+        p = parse<Person>(R"( { "married" : false , "x": null, "age":31,
+                                "y": {"age": 1}, "name" : "Jane" })");
+        BOOST_HANA_RUNTIME_CHECK(p.name == "Jane" && p.age == 31 && !p.married);
+
+        // missing members are left untouched
+        Person q{"John", 30, true};
+        BOOST_HANA_RUNTIME_CHECK(from_json(R"({"age":40})", q));
+        BOOST_HANA_RUNTIME_CHECK(q.name == "John" && q.age == 40 && q.married);
+
+        // nested Structs and sequences
+        Family f{{"John", 40, true}, hana::make_tuple(Person{"Ann", 10, false},
+                                                      Person{"Bob", 12, false}),
+                 1234.5};
+        Family g = round_trip(f);
+        BOOST_HANA_RUNTIME_CHECK(g.parent.name == "John" && g.parent.age == 40);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(g.children).name == "Ann");
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(g.children).age == 12);
+        BOOST_HANA_RUNTIME_CHECK(g.income == 1234.5);
+
+        BOOST_HANA_RUNTIME_CHECK(fails<Person>(R"({"age":"30"})"));
+        BOOST_HANA_RUNTIME_CHECK(fails<Person>(R"({"age":30)"));
+        BOOST_HANA_RUNTIME_CHECK(fails<Person>(R"({"age" 30})"));
+        BOOST_HANA_RUNTIME_CHECK(fails<Person>(R"({"age":30,})"));
+        BOOST_HANA_RUNTIME_CHECK(fails<Person>(R"({age:30})"));
+        BOOST_HANA_RUNTIME_CHECK(fails<Person>(R"([])"));
+    }
+}
@@ -0,0 +1,102 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/json.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <string>
+namespace hana = boost::hana;
+
+
+template <typename T>
+std::string to_json(T const& x) {
+    std::string result;
+    hana::experimental::to_json(std::back_inserter(result), x);
+    return result;
+}
+
+struct Empty {
+    BOOST_HANA_DEFINE_STRUCT(Empty);
+};
+
+struct Single {
+    BOOST_HANA_DEFINE_STRUCT(Single,
+        (int, value)
+    );
+};
+
+struct Nested {
+    BOOST_HANA_DEFINE_STRUCT(Nested,
+        (Single, single),
+        (Empty, empty),
+        (std::string, string),
+        (hana::tuple<int, bool>, tuple)
+    );
+};
+
+int main() {
+    // bool
+    {
+        BOOST_HANA_RUNTIME_CHECK(to_json(true) == "true");
+        BOOST_HANA_RUNTIME_CHECK(to_json(false) == "false");
+    }
+
+    // integers
+    {
+        BOOST_HANA_RUNTIME_CHECK(to_json(0) == "0");
+        BOOST_HANA_RUNTIME_CHECK(to_json(7) == "7");
+        BOOST_HANA_RUNTIME_CHECK(to_json(-42) == "-42");
+        BOOST_HANA_RUNTIME_CHECK(to_json(1234567890u) == "1234567890");
+        BOOST_HANA_RUNTIME_CHECK(to_json(std::numeric_limits<std::int64_t>::min()) == "-9223372036854775808");
+        BOOST_HANA_RUNTIME_CHECK(to_json(std::numeric_limits<std::uint64_t>::max()) == "18446744073709551615");
+        BOOST_HANA_RUNTIME_CHECK(to_json(static_cast<signed char>(-128)) == "-128");
+    }
+
+    // floating point numbers
+    {
+        BOOST_HANA_RUNTIME_CHECK(to_json(0.0) == "0");
+        BOOST_HANA_RUNTIME_CHECK(to_json(1.5) == "1.5");
+        BOOST_HANA_RUNTIME_CHECK(to_json(-0.25f) == "-0.25");
+        BOOST_HANA_RUNTIME_CHECK(to_json(std::numeric_limits<double>::infinity()) == "null");
+        BOOST_HANA_RUNTIME_CHECK(to_json(std::numeric_limits<double>::quiet_NaN()) == "null");
+    }
+
+    // strings
+    {
+        BOOST_HANA_RUNTIME_CHECK(to_json(std::string{}) == R"("")");
+        BOOST_HANA_RUNTIME_CHECK(to_json(std::string{"abc"}) == R"("abc")");
+        BOOST_HANA_RUNTIME_CHECK(to_json(std::string{"a\"b\\c"}) == R"("a\"b\\c")");
+        BOOST_HANA_RUNTIME_CHECK(to_json(std::string{"\b\f\n\r\t"}) == R"("\b\f\n\r\t")");
+        BOOST_HANA_RUNTIME_CHECK(to_json(std::string{"\x01\x1f"}) == R"("\u0001\u001f")");
+        BOOST_HANA_RUNTIME_CHECK(to_json(std::string{"\xc3\xa9t\xc3\xa9"}) == "\"\xc3\xa9t\xc3\xa9\"");
+    }
+
+    // sequences
+    {
+        BOOST_HANA_RUNTIME_CHECK(to_json(hana::make_tuple()) == "[]");
+        BOOST_HANA_RUNTIME_CHECK(to_json(hana::make_tuple(1)) == "[1]");
+        BOOST_HANA_RUNTIME_CHECK(to_json(hana::make_tuple(1, std::string{"x"}, true)) == R"([1,"x",true])");
+        BOOST_HANA_RUNTIME_CHECK(to_json(hana::make_tuple(hana::make_tuple(1, 2), hana::make_tuple())) == "[[1,2],[]]");
+    }
+
+    // Structs
+    {
+        BOOST_HANA_RUNTIME_CHECK(to_json(Empty{}) == "{}");
+        BOOST_HANA_RUNTIME_CHECK(to_json(Single{3}) == R"({"value":3})");
+        BOOST_HANA_RUNTIME_CHECK(to_json(Nested{{1}, {}, "s", hana::make_tuple(2, false)}) ==
+            R"({"single":{"value":1},"empty":{},"string":"s","tuple":[2,false]})");
+    }
+
+    // writing to a raw buffer
+    {
+        char buffer[64];
+        char* end = hana::experimental::to_json(buffer, Single{-12});
+        BOOST_HANA_RUNTIME_CHECK(std::string(buffer, end) == R"({"value":-12})");
+    }
+}
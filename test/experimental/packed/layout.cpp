@@ -0,0 +1,75 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/packed.hpp>
+
+#include <cstdint>
+namespace hana = boost::hana;
+
+
+struct Empty {
+    BOOST_HANA_DEFINE_STRUCT(Empty);
+};
+
+struct Sorted {
+    BOOST_HANA_DEFINE_STRUCT(Sorted,
+        (std::uint64_t, a),
+        (std::uint32_t, b),
+        (std::uint16_t, c),
+        (std::uint8_t, d)
+    );
+};
+
+struct Unsorted {
+    BOOST_HANA_DEFINE_STRUCT(Unsorted,
+        (std::uint8_t, a),
+        (std::uint64_t, b),
+        (std::uint16_t, c),
+        (std::uint32_t, d),
+        (std::uint8_t, e),
+        (std::uint64_t, f)
+    );
+};
+
+using Bytes = std::uint8_t[3];
+
+struct Nested {
+    BOOST_HANA_DEFINE_STRUCT(Nested,
+        (std::uint8_t, a),
+        (Sorted, b),
+        (Bytes, c)
+    );
+};
+
+int main() {
+    using hana::experimental::packed_layout;
+
+    static_assert(packed_layout<Empty>::size == 0, "");
+
+    // members already in order of decreasing alignment
+    static_assert(packed_layout<Sorted>::size == 15, "");
+    static_assert(packed_layout<Sorted>::offset(0) == 0, "");
+    static_assert(packed_layout<Sorted>::offset(1) == 8, "");
+    static_assert(packed_layout<Sorted>::offset(2) == 12, "");
+    static_assert(packed_layout<Sorted>::offset(3) == 14, "");
+    static_assert(packed_layout<Sorted>::data.runs[0] == 4, "");
+
+    // members are reordered, and members with the same alignment keep
+    // their relative order
+    static_assert(sizeof(Unsorted) > 24, "");
+    static_assert(packed_layout<Unsorted>::size == 24, "");
+    static_assert(packed_layout<Unsorted>::offset(1) == 0, "");
+    static_assert(packed_layout<Unsorted>::offset(5) == 8, "");
+    static_assert(packed_layout<Unsorted>::offset(3) == 16, "");
+    static_assert(packed_layout<Unsorted>::offset(2) == 20, "");
+    static_assert(packed_layout<Unsorted>::offset(0) == 22, "");
+    static_assert(packed_layout<Unsorted>::offset(4) == 23, "");
+
+    // nested Structs are copied as a whole, padding included
+    static_assert(packed_layout<Nested>::size == sizeof(Sorted) + 4, "");
+    static_assert(packed_layout<Nested>::offset(1) == 0, "");
+    static_assert(packed_layout<Nested>::offset(0) == sizeof(Sorted), "");
+    static_assert(packed_layout<Nested>::offset(2) == sizeof(Sorted) + 1, "");
+}
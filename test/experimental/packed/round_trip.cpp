@@ -0,0 +1,127 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/adapt_struct.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/packed.hpp>
+
+#include <cstdint>
+#include <cstring>
+namespace hana = boost::hana;
+
+
+struct Sorted {
+    BOOST_HANA_DEFINE_STRUCT(Sorted,
+        (double, a),
+        (std::int32_t, b),
+        (std::int16_t, c),
+        (char, d)
+    );
+};
+
+struct Unsorted {
+    BOOST_HANA_DEFINE_STRUCT(Unsorted,
+        (char, a),
+        (double, b),
+        (std::int16_t, c),
+        (std::int32_t, d),
+        (Sorted, e)
+    );
+};
+
+// A Struct whose accessors do not follow the declaration order.
+namespace ns {
+    struct Adapted {
+        std::int32_t x;
+        std::int64_t y;
+        std::int32_t z;
+    };
+}
+BOOST_HANA_ADAPT_STRUCT(ns::Adapted, z, y, x);
+
+// A Struct whose accessors are a permutation of its members of the same
+// size, so they form a single run in the packed representation even
+// though they are not laid out in that order in the object.
+namespace ns {
+    struct Permuted {
+        std::int32_t a, c, b, d;
+    };
+}
+BOOST_HANA_ADAPT_STRUCT(ns::Permuted, a, b, c, d);
+
+int main() {
+    using hana::experimental::from_packed;
+    using hana::experimental::packed_layout;
+    using hana::experimental::to_packed;
+
+    {
+        Sorted s{1.5, -2, 3, 'x'};
+        unsigned char buffer[packed_layout<Sorted>::size + 1];
+        buffer[packed_layout<Sorted>::size] = 0xAB;
+        BOOST_HANA_RUNTIME_CHECK(to_packed(buffer, s) == buffer + packed_layout<Sorted>::size);
+        BOOST_HANA_RUNTIME_CHECK(buffer[packed_layout<Sorted>::size] == 0xAB);
+
+        std::int32_t b;
+        std::memcpy(&b, buffer + packed_layout<Sorted>::offset(1), sizeof(b));
+        BOOST_HANA_RUNTIME_CHECK(b == -2);
+        BOOST_HANA_RUNTIME_CHECK(buffer[packed_layout<Sorted>::offset(3)] == 'x');
+
+        Sorted t{};
+        BOOST_HANA_RUNTIME_CHECK(from_packed(buffer, t) == buffer + packed_layout<Sorted>::size);
+        BOOST_HANA_RUNTIME_CHECK(t.a == 1.5 && t.b == -2 && t.c == 3 && t.d == 'x');
+    }
+
+    {
+        Unsorted s{'y', 2.5, 7, 8, {-1.5, 9, 10, 'z'}};
+        unsigned char buffer[packed_layout<Unsorted>::size];
+        to_packed(buffer, s);
+
+        double b;
+        std::memcpy(&b, buffer + packed_layout<Unsorted>::offset(1), sizeof(b));
+        BOOST_HANA_RUNTIME_CHECK(b == 2.5);
+        BOOST_HANA_RUNTIME_CHECK(buffer[packed_layout<Unsorted>::offset(0)] == 'y');
+
+        Unsorted t{};
+        from_packed(buffer, t);
+        BOOST_HANA_RUNTIME_CHECK(t.a == 'y' && t.b == 2.5 && t.c == 7 && t.d == 8);
+        BOOST_HANA_RUNTIME_CHECK(t.e.a == -1.5 && t.e.b == 9 && t.e.c == 10 && t.e.d == 'z');
+    }
+
+    {
+        // y is first since it has the largest alignment, and then z and x
+        // in the order of the accessors.
+        static_assert(packed_layout<ns::Adapted>::offset(1) == 0, "");
+        static_assert(packed_layout<ns::Adapted>::offset(0) == 8, "");
+        static_assert(packed_layout<ns::Adapted>::offset(2) == 12, "");
+
+        ns::Adapted s{1, 2, 3};
+        unsigned char buffer[packed_layout<ns::Adapted>::size];
+        to_packed(buffer, s);
+
+        std::int32_t z;
+        std::memcpy(&z, buffer + 8, sizeof(z));
+        BOOST_HANA_RUNTIME_CHECK(z == 3);
+
+        ns::Adapted t{};
+        from_packed(buffer, t);
+        BOOST_HANA_RUNTIME_CHECK(t.x == 1 && t.y == 2 && t.z == 3);
+    }
+
+    {
+        ns::Permuted s{1, 3, 2, 4};
+        unsigned char buffer[packed_layout<ns::Permuted>::size];
+        to_packed(buffer, s);
+
+        std::int32_t b, c;
+        std::memcpy(&b, buffer + packed_layout<ns::Permuted>::offset(1), sizeof(b));
+        std::memcpy(&c, buffer + packed_layout<ns::Permuted>::offset(2), sizeof(c));
+        BOOST_HANA_RUNTIME_CHECK(b == 2);
+        BOOST_HANA_RUNTIME_CHECK(c == 3);
+
+        ns::Permuted t{};
+        from_packed(buffer, t);
+        BOOST_HANA_RUNTIME_CHECK(t.a == 1 && t.b == 2 && t.c == 3 && t.d == 4);
+    }
+}
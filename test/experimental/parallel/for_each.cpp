@@ -0,0 +1,100 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/parallel.hpp>
+#include <boost/hana/ext/std/tuple.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+
+#include <atomic>
+#include <string>
+#include <tuple>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+template <int i>
+struct counter {
+    int value = 0;
+};
+
+struct increment {
+    std::atomic<int>* calls;
+
+    template <int i>
+    void operator()(counter<i>& c) const {
+        c.value += i;
+        ++*calls;
+    }
+};
+
+int main() {
+    hana::experimental::thread_pool pool{3};
+    hana::experimental::thread_pool inline_pool{0};
+
+    // empty sequences
+    {
+        std::atomic<int> calls{0};
+        hana::experimental::for_each(hana::experimental::par,
+            hana::make_tuple(), increment{&calls});
+        hana::experimental::for_each(hana::experimental::par.on(pool),
+            hana::make_tuple(), increment{&calls});
+        BOOST_HANA_RUNTIME_CHECK(calls == 0);
+    }
+
+    // every element is visited exactly once, through a reference
+    {
+        std::atomic<int> calls{0};
+        auto xs = hana::make_tuple(counter<1>{}, counter<2>{}, counter<3>{},
+                                   counter<4>{}, counter<5>{}, counter<6>{},
+                                   counter<7>{}, counter<8>{}, counter<9>{});
+
+        hana::experimental::for_each(hana::experimental::par, xs, increment{&calls});
+        BOOST_HANA_RUNTIME_CHECK(calls == 9);
+
+        hana::experimental::for_each(hana::experimental::par.on(pool), xs, increment{&calls});
+        BOOST_HANA_RUNTIME_CHECK(calls == 18);
+
+        hana::experimental::for_each(hana::experimental::par.on(inline_pool), xs, increment{&calls});
+        BOOST_HANA_RUNTIME_CHECK(calls == 27);
+
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(xs).value == 3);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<4>(xs).value == 15);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<8>(xs).value == 27);
+    }
+
+    // works with other Iterables
+    {
+        std::atomic<int> calls{0};
+        std::tuple<counter<1>, counter<2>> xs;
+        hana::experimental::for_each(hana::experimental::par.on(pool), xs, increment{&calls});
+        BOOST_HANA_RUNTIME_CHECK(calls == 2);
+        BOOST_HANA_RUNTIME_CHECK(std::get<1>(xs).value == 2);
+    }
+
+    // rvalue sequences have their elements moved out
+    {
+        std::string results[3];
+        auto xs = hana::make_tuple(std::string(50, 'a'), std::string(50, 'b'),
+                                   std::string(50, 'c'));
+        hana::experimental::for_each(hana::experimental::par.on(pool), std::move(xs),
+            [&](std::string&& s) {
+                results[s[0] - 'a'] = std::move(s);
+            });
+        BOOST_HANA_RUNTIME_CHECK(results[0] == std::string(50, 'a'));
+        BOOST_HANA_RUNTIME_CHECK(results[1] == std::string(50, 'b'));
+        BOOST_HANA_RUNTIME_CHECK(results[2] == std::string(50, 'c'));
+    }
+
+    // heterogeneous elements
+    {
+        std::atomic<int> calls{0};
+        hana::experimental::for_each(hana::experimental::par.on(pool),
+            hana::make_tuple(ct_eq<0>{}, 1, '2', std::string{"3"}),
+            [&](auto const&) { ++calls; });
+        BOOST_HANA_RUNTIME_CHECK(calls == 4);
+    }
+}
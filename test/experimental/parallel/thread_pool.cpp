@@ -0,0 +1,89 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/parallel.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct error : std::runtime_error {
+    error() : std::runtime_error{"error"} { }
+};
+
+int main() {
+    BOOST_HANA_RUNTIME_CHECK(hana::experimental::thread_pool{0}.size() == 0);
+    BOOST_HANA_RUNTIME_CHECK(hana::experimental::thread_pool{4}.size() == 4);
+
+    hana::experimental::thread_pool pool{3};
+    auto xs = hana::make_tuple(0, 1, 2, 3, 4, 5, 6, 7);
+
+    // exceptions are propagated to the caller once all the tasks are done
+    {
+        std::atomic<int> calls{0};
+        bool thrown = false;
+        try {
+            hana::experimental::for_each(hana::experimental::par.on(pool), xs, [&](int i) {
+                ++calls;
+                if (i % 3 == 0)
+                    throw error{};
+            });
+        } catch (error const&) {
+            thrown = true;
+        }
+        BOOST_HANA_RUNTIME_CHECK(thrown);
+        BOOST_HANA_RUNTIME_CHECK(calls == 8);
+
+        thrown = false;
+        try {
+            hana::experimental::transform(hana::experimental::par.on(pool), xs, [](int i) {
+                if (i == 5)
+                    throw error{};
+                return std::vector<int>(i, i);
+            });
+        } catch (error const&) {
+            thrown = true;
+        }
+        BOOST_HANA_RUNTIME_CHECK(thrown);
+    }
+
+    // the pool can be used from its own tasks
+    {
+        std::atomic<int> calls{0};
+        hana::experimental::for_each(hana::experimental::par.on(pool), xs, [&](int) {
+            hana::experimental::for_each(hana::experimental::par.on(pool), xs, [&](int) {
+                ++calls;
+            });
+        });
+        BOOST_HANA_RUNTIME_CHECK(calls == 64);
+    }
+
+    // the pool can be used from several threads at once
+    {
+        std::atomic<int> calls{0};
+        std::vector<std::thread> threads;
+        for (int t = 0; t != 4; ++t) {
+            threads.emplace_back([&] {
+                for (int n = 0; n != 100; ++n) {
+                    hana::experimental::for_each(hana::experimental::par.on(pool), xs, [&](int) {
+                        ++calls;
+                    });
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+            thread.join();
+        BOOST_HANA_RUNTIME_CHECK(calls == 4 * 100 * 8);
+    }
+
+    // the pool is joined when destroyed, even when it's never been used
+    {
+        hana::experimental::thread_pool unused{2};
+    }
+}
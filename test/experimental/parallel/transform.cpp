@@ -0,0 +1,120 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/parallel.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <support/tracked.hpp>
+
+#include <memory>
+#include <string>
+#include <type_traits>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+struct f {
+    template <int i>
+    constexpr auto operator()(ct_eq<i>) const { return ct_eq<i + 10>{}; }
+
+    int operator()(int i) const { return i * 2; }
+
+    std::string operator()(char const* s) const { return s; }
+
+    std::unique_ptr<int> operator()(std::unique_ptr<int>&& p) const
+    { return std::move(p); }
+};
+
+struct non_default_constructible {
+    explicit non_default_constructible(int v) : value{v} { }
+    int value;
+};
+
+int main() {
+    hana::experimental::thread_pool pool{3};
+    hana::experimental::thread_pool inline_pool{0};
+
+    // empty sequences
+    {
+        auto result = hana::experimental::transform(hana::experimental::par,
+            hana::make_tuple(), f{});
+        static_assert(std::is_same<decltype(result), hana::tuple<>>{}, "");
+    }
+
+    // the results are in the same order as the elements
+    {
+        auto xs = hana::make_tuple(ct_eq<0>{}, 1, "two", ct_eq<3>{}, 4);
+
+        auto result = hana::experimental::transform(hana::experimental::par, xs, f{});
+        static_assert(std::is_same<
+            decltype(result),
+            hana::tuple<ct_eq<10>, int, std::string, ct_eq<13>, int>
+        >{}, "");
+        BOOST_HANA_RUNTIME_CHECK(hana::equal(
+            result,
+            hana::make_tuple(ct_eq<10>{}, 2, std::string{"two"}, ct_eq<13>{}, 8)
+        ));
+
+        BOOST_HANA_RUNTIME_CHECK(hana::equal(
+            hana::experimental::transform(hana::experimental::par.on(pool), xs, f{}),
+            result
+        ));
+
+        BOOST_HANA_RUNTIME_CHECK(hana::equal(
+            hana::experimental::transform(hana::experimental::par.on(inline_pool), xs, f{}),
+            result
+        ));
+    }
+
+    // many elements
+    {
+        auto result = hana::experimental::transform(hana::experimental::par.on(pool),
+            hana::make_tuple(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+            f{});
+        BOOST_HANA_RUNTIME_CHECK(result == hana::make_tuple(
+            0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30
+        ));
+    }
+
+    // move-only elements and results, and rvalue sequences
+    {
+        auto result = hana::experimental::transform(hana::experimental::par.on(pool),
+            hana::make_tuple(std::make_unique<int>(1), std::make_unique<int>(2)),
+            f{});
+        BOOST_HANA_RUNTIME_CHECK(*hana::at_c<0>(result) == 1);
+        BOOST_HANA_RUNTIME_CHECK(*hana::at_c<1>(result) == 2);
+    }
+
+    // results that are not default constructible
+    {
+        auto result = hana::experimental::transform(hana::experimental::par.on(pool),
+            hana::make_tuple(1, 2, 3),
+            [](int i) { return non_default_constructible{i}; });
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(result).value == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<2>(result).value == 3);
+    }
+
+    // results are stored by value
+    {
+        int i = 0, j = 1;
+        auto result = hana::experimental::transform(hana::experimental::par.on(pool),
+            hana::make_tuple(&i, &j),
+            [](int* p) -> int& { return *p; });
+        static_assert(std::is_same<decltype(result), hana::tuple<int, int>>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(result == hana::make_tuple(0, 1));
+    }
+
+    // no result is leaked or destroyed twice
+    {
+        {
+            auto result = hana::experimental::transform(hana::experimental::par.on(pool),
+                hana::make_tuple(1, 2, 3, 4),
+                [](int i) { return Tracked{i}; });
+            (void)result;
+        }
+    }
+}
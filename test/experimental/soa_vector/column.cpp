@@ -0,0 +1,106 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/adapt_struct.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/soa_vector.hpp>
+#include <boost/hana/string.hpp>
+
+#include <cstdint>
+#include <numeric>
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+struct Tick {
+    BOOST_HANA_DEFINE_STRUCT(Tick,
+        (char, side),
+        (double, price),
+        (bool, valid),
+        (std::int16_t, venue)
+    );
+};
+
+struct alignas(128) Overaligned {
+    double value;
+};
+
+struct WithOveraligned {
+    int key;
+    Overaligned payload;
+};
+
+BOOST_HANA_ADAPT_STRUCT(WithOveraligned, payload, key);
+
+template <typename T>
+bool is_aligned(T const* p, std::size_t alignment)
+{ return reinterpret_cast<std::uintptr_t>(p) % alignment == 0; }
+
+int main() {
+    hana::experimental::soa_vector<Tick> v;
+    for (int i = 0; i != 37; ++i)
+        v.push_back(Tick{i % 2 ? 'b' : 's', i * 0.5, i % 3 == 0, static_cast<std::int16_t>(i)});
+    auto const& cv = v;
+
+    // the columns have the types of the members
+    {
+        auto price = BOOST_HANA_STRING("price");
+        auto valid = BOOST_HANA_STRING("valid");
+        static_assert(std::is_same<
+            decltype(v.column(price)),
+            hana::experimental::soa_span<double>
+        >{}, "");
+        static_assert(std::is_same<
+            decltype(cv.column(price)),
+            hana::experimental::soa_span<double const>
+        >{}, "");
+        static_assert(std::is_same<
+            decltype(v.column(valid)),
+            hana::experimental::soa_span<bool>
+        >{}, "");
+    }
+
+    // the columns are contiguous and contain the members of every row
+    {
+        auto prices = v.column(BOOST_HANA_STRING("price"));
+        BOOST_HANA_RUNTIME_CHECK(prices.size() == 37);
+        BOOST_HANA_RUNTIME_CHECK(!prices.empty());
+        BOOST_HANA_RUNTIME_CHECK(prices.end() - prices.begin() == 37);
+        BOOST_HANA_RUNTIME_CHECK(prices.data() == prices.begin());
+        BOOST_HANA_RUNTIME_CHECK(std::accumulate(prices.begin(), prices.end(), 0.0) == 333.0);
+
+        auto valid = cv.column(BOOST_HANA_STRING("valid"));
+        BOOST_HANA_RUNTIME_CHECK(std::accumulate(valid.begin(), valid.end(), 0) == 13);
+
+        auto venues = v.column(BOOST_HANA_STRING("venue"));
+        for (std::size_t i = 0; i != venues.size(); ++i)
+            BOOST_HANA_RUNTIME_CHECK(venues[i] == static_cast<std::int16_t>(i));
+    }
+
+    // the columns can be modified
+    {
+        for (double& price : v.column(BOOST_HANA_STRING("price")))
+            price *= 2;
+        BOOST_HANA_RUNTIME_CHECK(v[3].get<1>() == 3.0);
+    }
+
+    // the columns are aligned
+    {
+        BOOST_HANA_RUNTIME_CHECK(is_aligned(v.column(BOOST_HANA_STRING("side")).data(), 64));
+        BOOST_HANA_RUNTIME_CHECK(is_aligned(v.column(BOOST_HANA_STRING("price")).data(), 64));
+        BOOST_HANA_RUNTIME_CHECK(is_aligned(v.column(BOOST_HANA_STRING("valid")).data(), 64));
+        BOOST_HANA_RUNTIME_CHECK(is_aligned(v.column(BOOST_HANA_STRING("venue")).data(), 64));
+
+        hana::experimental::soa_vector<WithOveraligned> w(3);
+        BOOST_HANA_RUNTIME_CHECK(is_aligned(w.column(BOOST_HANA_STRING("payload")).data(), 128));
+        BOOST_HANA_RUNTIME_CHECK(is_aligned(w.column(BOOST_HANA_STRING("key")).data(), 64));
+    }
+
+    // empty containers have empty columns
+    {
+        hana::experimental::soa_vector<Tick> empty;
+        BOOST_HANA_RUNTIME_CHECK(empty.column(BOOST_HANA_STRING("price")).empty());
+    }
+}
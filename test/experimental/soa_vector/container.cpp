@@ -0,0 +1,155 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/soa_vector.hpp>
+#include <boost/hana/string.hpp>
+
+#include <support/tracked.hpp>
+
+#include <string>
+#include <utility>
+namespace hana = boost::hana;
+
+
+struct Order {
+    BOOST_HANA_DEFINE_STRUCT(Order,
+        (int, id),
+        (double, price),
+        (bool, buy),
+        (std::string, symbol)
+    );
+};
+
+struct TrackedPair {
+    BOOST_HANA_DEFINE_STRUCT(TrackedPair,
+        (Tracked, first),
+        (Tracked, second)
+    );
+};
+
+template <typename S>
+bool same_rows(hana::experimental::soa_vector<S> const& v, std::size_t n) {
+    auto ids = v.column(BOOST_HANA_STRING("id"));
+    auto symbols = v.column(BOOST_HANA_STRING("symbol"));
+    if (v.size() != n || ids.size() != n || symbols.size() != n)
+        return false;
+    for (std::size_t i = 0; i != n; ++i) {
+        if (ids[i] != static_cast<int>(i) || symbols[i] != std::to_string(i))
+            return false;
+    }
+    return true;
+}
+
+int main() {
+    using Orders = hana::experimental::soa_vector<Order>;
+
+    // default construction
+    {
+        Orders v;
+        BOOST_HANA_RUNTIME_CHECK(v.size() == 0);
+        BOOST_HANA_RUNTIME_CHECK(v.empty());
+        BOOST_HANA_RUNTIME_CHECK(v.capacity() == 0);
+    }
+
+    // construction with a size, which value-initializes the rows
+    {
+        Orders v(3);
+        BOOST_HANA_RUNTIME_CHECK(v.size() == 3);
+        for (std::size_t i = 0; i != 3; ++i) {
+            BOOST_HANA_RUNTIME_CHECK(v[i].get<0>() == 0);
+            BOOST_HANA_RUNTIME_CHECK(v[i].get<1>() == 0.0);
+            BOOST_HANA_RUNTIME_CHECK(v[i].get<2>() == false);
+            BOOST_HANA_RUNTIME_CHECK(v[i].get<3>() == "");
+        }
+    }
+
+    // push_back, pop_back and growth
+    {
+        Orders v;
+        for (int i = 0; i != 100; ++i) {
+            Order o{i, i * 1.5, i % 2 == 0, std::to_string(i)};
+            if (i % 2)
+                v.push_back(o);
+            else
+                v.push_back(std::move(o));
+        }
+        BOOST_HANA_RUNTIME_CHECK(same_rows(v, 100));
+        BOOST_HANA_RUNTIME_CHECK(v.capacity() >= 100);
+
+        v.pop_back();
+        v.pop_back();
+        BOOST_HANA_RUNTIME_CHECK(same_rows(v, 98));
+    }
+
+    // reserve and resize
+    {
+        Orders v;
+        v.reserve(10);
+        BOOST_HANA_RUNTIME_CHECK(v.capacity() == 10);
+        BOOST_HANA_RUNTIME_CHECK(v.size() == 0);
+
+        for (int i = 0; i != 5; ++i)
+            v.push_back(Order{i, 0.0, false, std::to_string(i)});
+        v.reserve(3);
+        BOOST_HANA_RUNTIME_CHECK(v.capacity() == 10);
+
+        v.resize(3);
+        BOOST_HANA_RUNTIME_CHECK(same_rows(v, 3));
+
+        v.resize(20);
+        BOOST_HANA_RUNTIME_CHECK(v.size() == 20);
+        BOOST_HANA_RUNTIME_CHECK(v.capacity() >= 20);
+        BOOST_HANA_RUNTIME_CHECK(v[2].get<3>() == "2");
+        BOOST_HANA_RUNTIME_CHECK(v[19].get<3>() == "");
+
+        v.clear();
+        BOOST_HANA_RUNTIME_CHECK(v.empty());
+        BOOST_HANA_RUNTIME_CHECK(v.capacity() >= 20);
+    }
+
+    // copy, move and swap
+    {
+        Orders v;
+        for (int i = 0; i != 10; ++i)
+            v.push_back(Order{i, 0.0, false, std::to_string(i)});
+
+        Orders copy{v};
+        BOOST_HANA_RUNTIME_CHECK(same_rows(copy, 10));
+        BOOST_HANA_RUNTIME_CHECK(same_rows(v, 10));
+
+        Orders moved{std::move(copy)};
+        BOOST_HANA_RUNTIME_CHECK(same_rows(moved, 10));
+        BOOST_HANA_RUNTIME_CHECK(copy.empty());
+
+        Orders assigned;
+        assigned = v;
+        BOOST_HANA_RUNTIME_CHECK(same_rows(assigned, 10));
+        assigned = Orders{};
+        BOOST_HANA_RUNTIME_CHECK(assigned.empty());
+        assigned = std::move(moved);
+        BOOST_HANA_RUNTIME_CHECK(same_rows(assigned, 10));
+
+        Orders other;
+        other.push_back(Order{0, 0.0, false, "0"});
+        swap(other, assigned);
+        BOOST_HANA_RUNTIME_CHECK(same_rows(other, 10));
+        BOOST_HANA_RUNTIME_CHECK(same_rows(assigned, 1));
+    }
+
+    // elements are constructed and destroyed exactly once
+    {
+        hana::experimental::soa_vector<TrackedPair> v;
+        for (int i = 0; i != 20; ++i)
+            v.push_back(TrackedPair{Tracked{i}, Tracked{-i}});
+
+        auto copy = v;
+        while (copy.size() != 4)
+            copy.pop_back();
+        BOOST_HANA_RUNTIME_CHECK(copy[3].get<0>().value == 3);
+        BOOST_HANA_RUNTIME_CHECK(copy[3].get<1>().value == -3);
+        BOOST_HANA_RUNTIME_CHECK(v[19].get<1>().value == -19);
+    }
+}
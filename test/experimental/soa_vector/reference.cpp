@@ -0,0 +1,102 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/soa_vector.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/string.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+namespace hana = boost::hana;
+
+
+struct Order {
+    BOOST_HANA_DEFINE_STRUCT(Order,
+        (int, id),
+        (double, price),
+        (std::string, symbol)
+    );
+};
+
+using Orders = hana::experimental::soa_vector<Order>;
+
+int main() {
+    Orders v;
+    v.push_back(Order{1, 10.5, "abc"});
+    v.push_back(Order{2, 20.5, "def"});
+    Orders const& cv = v;
+
+    // rows are Structs with the same keys as the value type
+    {
+        static_assert(hana::Struct<Orders::reference>::value, "");
+        static_assert(hana::Struct<Orders::const_reference>::value, "");
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::keys(v[0]), hana::keys(Order{})));
+    }
+
+    // at_key returns references to the elements
+    {
+        auto row = v[1];
+        auto price = BOOST_HANA_STRING("price");
+        static_assert(std::is_same<
+            decltype(hana::at_key(row, price)), double&
+        >{}, "");
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(row, BOOST_HANA_STRING("id")) == 2);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(row, BOOST_HANA_STRING("price")) == 20.5);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(row, BOOST_HANA_STRING("symbol")) == "def");
+
+        hana::at_key(row, BOOST_HANA_STRING("price")) = 30.5;
+        BOOST_HANA_RUNTIME_CHECK(v.column(BOOST_HANA_STRING("price"))[1] == 30.5);
+
+        auto const_row = cv[1];
+        static_assert(std::is_same<
+            decltype(hana::at_key(const_row, price)), double const&
+        >{}, "");
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(const_row, BOOST_HANA_STRING("price")) == 30.5);
+
+        Orders::const_reference converted = v[0];
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(converted, BOOST_HANA_STRING("id")) == 1);
+    }
+
+    // rows can be converted to the value type
+    {
+        Order o = cv[0];
+        BOOST_HANA_RUNTIME_CHECK(o.id == 1);
+        BOOST_HANA_RUNTIME_CHECK(o.price == 10.5);
+        BOOST_HANA_RUNTIME_CHECK(o.symbol == "abc");
+    }
+
+    // assigning to a row assigns its elements
+    {
+        v[0] = Order{3, 1.0, "ghi"};
+        BOOST_HANA_RUNTIME_CHECK(v[0].get<0>() == 3);
+        BOOST_HANA_RUNTIME_CHECK(v[0].get<2>() == "ghi");
+
+        Order o{4, 2.0, "jkl"};
+        v[1] = std::move(o);
+        BOOST_HANA_RUNTIME_CHECK(v[1].get<2>() == "jkl");
+
+        v[0] = cv[1];
+        BOOST_HANA_RUNTIME_CHECK(v[0].get<0>() == 4);
+        BOOST_HANA_RUNTIME_CHECK(v[0].get<2>() == "jkl");
+
+        v.push_back(Order{5, 3.0, "mno"});
+        auto first = v[0];
+        first = v[2];
+        BOOST_HANA_RUNTIME_CHECK(v[0].get<0>() == 5);
+        BOOST_HANA_RUNTIME_CHECK(v[2].get<0>() == 5);
+        BOOST_HANA_RUNTIME_CHECK(v[1].get<0>() == 4);
+    }
+
+    // rows can be compared like any other Struct
+    {
+        BOOST_HANA_RUNTIME_CHECK(hana::equal(v[0], v[2]));
+        BOOST_HANA_RUNTIME_CHECK(!hana::equal(v[0], v[1]));
+    }
+}
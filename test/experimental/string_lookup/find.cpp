@@ -0,0 +1,95 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/string_lookup.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+namespace hana = boost::hana;
+
+
+// Creates the key "k<i>", where <i> is written with three digits.
+template <std::size_t i>
+constexpr auto key = hana::string_c<'k',
+    static_cast<char>('0' + i / 100), static_cast<char>('0' + i / 10 % 10),
+    static_cast<char>('0' + i % 10)
+>;
+
+template <std::size_t ...i>
+constexpr auto make_lookup(std::index_sequence<i...>) {
+    return hana::experimental::make_string_lookup(hana::make_tuple(key<i>...));
+}
+
+int main() {
+    // empty lookup
+    {
+        constexpr auto lookup = hana::experimental::make_string_lookup(hana::make_tuple());
+        static_assert(lookup.size() == 0, "");
+        static_assert(lookup.find("", 0) == 0, "");
+        static_assert(lookup.find("abc", 3) == 0, "");
+    }
+
+    // single key
+    {
+        constexpr auto lookup = hana::experimental::make_string_lookup(
+            hana::make_tuple(hana::string_c<'a', 'b', 'c'>)
+        );
+        static_assert(lookup.size() == 1, "");
+        static_assert(lookup.find("abc", 3) == 0, "");
+        static_assert(lookup.find("ab", 2) == 1, "");
+        static_assert(lookup.find("abd", 3) == 1, "");
+        static_assert(lookup.find("abcd", 4) == 1, "");
+        static_assert(lookup.find("", 0) == 1, "");
+    }
+
+    // the index of a key is its position in the Foldable
+    {
+        constexpr auto lookup = hana::experimental::make_string_lookup(hana::make_tuple(
+            hana::string_c<'n', 'a', 'm', 'e'>, hana::string_c<'a', 'g', 'e'>,
+            hana::string_c<>, hana::string_c<'n', 'a', 'm'>
+        ));
+        static_assert(lookup.size() == 4, "");
+        static_assert(lookup.find("name", 4) == 0, "");
+        static_assert(lookup.find("age", 3) == 1, "");
+        static_assert(lookup.find("", 0) == 2, "");
+        static_assert(lookup.find("nam", 3) == 3, "");
+        static_assert(lookup.find("na", 2) == 4, "");
+        static_assert(lookup.find("names", 5) == 4, "");
+
+        // only the given number of characters are considered
+        static_assert(lookup.find("name", 3) == 3, "");
+        static_assert(lookup.find("agent", 3) == 1, "");
+    }
+
+    // with runtime strings
+    {
+        auto lookup = hana::experimental::make_string_lookup(hana::make_tuple(
+            hana::string_c<'n', 'a', 'm', 'e'>, hana::string_c<'a', 'g', 'e'>
+        ));
+        BOOST_HANA_RUNTIME_CHECK(lookup.find(std::string{"name"}) == 0);
+        BOOST_HANA_RUNTIME_CHECK(lookup.find(std::string{"age"}) == 1);
+        BOOST_HANA_RUNTIME_CHECK(lookup.find(std::string{"email"}) == 2);
+        BOOST_HANA_RUNTIME_CHECK(lookup.find(std::string{""}) == 2);
+    }
+
+    // many keys
+    {
+        constexpr std::size_t N = 300;
+        constexpr auto lookup = make_lookup(std::make_index_sequence<N>{});
+        static_assert(lookup.size() == N, "");
+        for (std::size_t i = 0; i < N; ++i) {
+            char k[] = {'k', static_cast<char>('0' + i / 100),
+                             static_cast<char>('0' + i / 10 % 10),
+                             static_cast<char>('0' + i % 10)};
+            BOOST_HANA_RUNTIME_CHECK(lookup.find(k, 4) == i);
+            BOOST_HANA_RUNTIME_CHECK(lookup.find(k, 3) == N);
+        }
+        BOOST_HANA_RUNTIME_CHECK(lookup.find("k300", 4) == N);
+        BOOST_HANA_RUNTIME_CHECK(lookup.find("x000", 4) == N);
+    }
+}
@@ -0,0 +1,39 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+// view.hpp opens `experimental::detail`, which must not hide `hana::detail`
+// from string_lookup.hpp and json.hpp when they are included afterwards.
+#include <boost/hana/experimental/view.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/json.hpp>
+#include <boost/hana/experimental/string_lookup.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+
+
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (int, x),
+        (int, y)
+    );
+};
+
+int main() {
+    auto lookup = hana::experimental::make_string_lookup(
+        hana::make_tuple(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("de"))
+    );
+    BOOST_HANA_RUNTIME_CHECK(lookup.find(std::string{"de"}) == 1);
+    BOOST_HANA_RUNTIME_CHECK(lookup.find(std::string{"x"}) == 2);
+
+    std::string json = R"({"y": 2, "x": 1})";
+    Point p{};
+    char const* last = json.data() + json.size();
+    BOOST_HANA_RUNTIME_CHECK(hana::experimental::from_json(json.data(), last, p) == last);
+    BOOST_HANA_RUNTIME_CHECK(p.x == 1 && p.y == 2);
+}
@@ -0,0 +1,86 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/string_lookup.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+
+
+int main() {
+    // the matching key is passed to the visitor
+    {
+        auto lookup = hana::experimental::make_string_lookup(hana::make_tuple(
+            BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("de")
+        ));
+
+        auto check = [](auto expected) {
+            return [=](auto key) {
+                return hana::equal(key, expected) ? 1 : -1;
+            };
+        };
+
+        BOOST_HANA_RUNTIME_CHECK(lookup.visit("abc", 3, check(BOOST_HANA_STRING("abc")), [] { return 0; }) == 1);
+        BOOST_HANA_RUNTIME_CHECK(lookup.visit("de", 2, check(BOOST_HANA_STRING("de")), [] { return 0; }) == 1);
+        BOOST_HANA_RUNTIME_CHECK(lookup.visit("d", 1, [](auto) { return 1; }, [] { return 0; }) == 0);
+        BOOST_HANA_RUNTIME_CHECK(lookup.visit(std::string{"de"}, check(BOOST_HANA_STRING("de")), [] { return 0; }) == 1);
+        BOOST_HANA_RUNTIME_CHECK(lookup.visit(std::string{"x"}, [](auto) { return 1; }, [] { return 0; }) == 0);
+    }
+
+    // the result of the visitor is converted to the result of `otherwise`
+    {
+        auto lookup = hana::experimental::make_string_lookup(hana::make_tuple(
+            BOOST_HANA_STRING("a"), BOOST_HANA_STRING("bb")
+        ));
+        auto length = [](auto key) { return hana::length(key); };
+        auto none = []() -> std::size_t { return 0; };
+        BOOST_HANA_RUNTIME_CHECK(lookup.visit("a", 1, length, none) == 1);
+        BOOST_HANA_RUNTIME_CHECK(lookup.visit("bb", 2, length, none) == 2);
+        BOOST_HANA_RUNTIME_CHECK(lookup.visit("c", 1, length, none) == 0);
+    }
+
+    // visitors returning void
+    {
+        auto lookup = hana::experimental::make_string_lookup(hana::make_tuple(
+            BOOST_HANA_STRING("a")
+        ));
+        int found = 0, not_found = 0;
+        lookup.visit("a", 1, [&](auto) { ++found; }, [&] { ++not_found; });
+        lookup.visit("b", 1, [&](auto) { ++found; }, [&] { ++not_found; });
+        BOOST_HANA_RUNTIME_CHECK(found == 1 && not_found == 1);
+    }
+
+    // empty lookup
+    {
+        auto lookup = hana::experimental::make_string_lookup(hana::make_tuple());
+        BOOST_HANA_RUNTIME_CHECK(lookup.visit("", 0, [](auto) { return 1; }, [] { return 0; }) == 0);
+    }
+
+    // with the keys of a map
+    {
+        auto map = hana::make_map(
+            hana::make_pair(BOOST_HANA_STRING("one"), 1),
+            hana::make_pair(BOOST_HANA_STRING("two"), 2),
+            hana::make_pair(BOOST_HANA_STRING("three"), 3)
+        );
+        auto lookup = hana::experimental::make_string_lookup(hana::keys(map));
+        auto value_of = [&](std::string const& name) {
+            return lookup.visit(name, [&](auto key) { return map[key]; }, [] { return 0; });
+        };
+
+        BOOST_HANA_RUNTIME_CHECK(value_of("one") == 1);
+        BOOST_HANA_RUNTIME_CHECK(value_of("two") == 2);
+        BOOST_HANA_RUNTIME_CHECK(value_of("three") == 3);
+        BOOST_HANA_RUNTIME_CHECK(value_of("four") == 0);
+    }
+}
@@ -0,0 +1,87 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/append.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/tuple_builder.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <support/tracked_move_only.hpp>
+
+#include <utility>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto empty = hana::experimental::make_tuple_builder();
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_tuple(hana::append(empty, ct_eq<0>{})),
+        hana::make_tuple(ct_eq<0>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_tuple(hana::append(hana::append(empty, ct_eq<0>{}), ct_eq<1>{})),
+        hana::make_tuple(ct_eq<0>{}, ct_eq<1>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_tuple(hana::append(
+            hana::experimental::make_tuple_builder(ct_eq<0>{}, ct_eq<1>{}), ct_eq<2>{}
+        )),
+        hana::make_tuple(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})
+    ));
+
+    // appending leaves the original builder untouched
+    {
+        auto xs = hana::experimental::make_tuple_builder(ct_eq<0>{});
+        auto ys = hana::append(xs, ct_eq<1>{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::to_tuple(xs), hana::make_tuple(ct_eq<0>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::to_tuple(ys), hana::make_tuple(ct_eq<0>{}, ct_eq<1>{})
+        ));
+    }
+
+    // with fold_left
+    {
+        auto ints = hana::fold_left(hana::range_c<int, 0, 50>, empty, hana::append);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::to_tuple(ints),
+            hana::to_tuple(hana::range_c<int, 0, 50>)
+        ));
+
+        constexpr auto values = hana::to_tuple(hana::fold_left(
+            hana::make_tuple(1, '2', 3.0), hana::experimental::make_tuple_builder(), hana::append
+        ));
+        static_assert(values == hana::make_tuple(1, '2', 3.0), "");
+    }
+
+    // move-only elements
+    {
+        auto builder = hana::append(
+            hana::append(empty, TrackedMoveOnly<0>{}), TrackedMoveOnly<1>{}
+        );
+        auto tuple = hana::to_tuple(std::move(builder));
+        BOOST_HANA_CONSTANT_CHECK(hana::at_c<0>(tuple) == TrackedMoveOnly<0>{});
+        BOOST_HANA_CONSTANT_CHECK(hana::at_c<1>(tuple) == TrackedMoveOnly<1>{});
+    }
+
+    // builders as elements of builders
+    {
+        auto inner = hana::experimental::make_tuple_builder(ct_eq<0>{});
+        auto outer = hana::append(hana::append(empty, inner), inner);
+        auto tuple = hana::to_tuple(outer);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::to_tuple(hana::at_c<0>(tuple)), hana::make_tuple(ct_eq<0>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::to_tuple(hana::at_c<1>(tuple)), hana::make_tuple(ct_eq<0>{})
+        ));
+    }
+}
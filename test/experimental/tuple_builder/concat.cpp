@@ -0,0 +1,60 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/append.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/concat.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/tuple_builder.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <support/tracked_move_only.hpp>
+
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto builder = hana::experimental::make_tuple_builder;
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_tuple(hana::concat(builder(), builder())),
+        hana::make_tuple()
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_tuple(hana::concat(builder(ct_eq<0>{}), builder())),
+        hana::make_tuple(ct_eq<0>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_tuple(hana::concat(builder(), builder(ct_eq<0>{}))),
+        hana::make_tuple(ct_eq<0>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to_tuple(hana::concat(builder(ct_eq<0>{}, ct_eq<1>{}),
+                                    builder(ct_eq<2>{}, ct_eq<3>{}, ct_eq<4>{}))),
+        hana::make_tuple(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{}, ct_eq<4>{})
+    ));
+
+    // builders made of several parts
+    {
+        auto xs = hana::append(builder(ct_eq<0>{}), ct_eq<1>{});
+        auto ys = hana::append(builder(ct_eq<2>{}), ct_eq<3>{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::to_tuple(hana::append(hana::concat(xs, ys), ct_eq<4>{})),
+            hana::make_tuple(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{}, ct_eq<4>{})
+        ));
+    }
+
+    // move-only elements
+    {
+        auto tuple = hana::to_tuple(hana::concat(
+            builder(TrackedMoveOnly<0>{}),
+            builder(TrackedMoveOnly<1>{}, TrackedMoveOnly<2>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::at_c<0>(tuple) == TrackedMoveOnly<0>{});
+        BOOST_HANA_CONSTANT_CHECK(hana::at_c<1>(tuple) == TrackedMoveOnly<1>{});
+        BOOST_HANA_CONSTANT_CHECK(hana::at_c<2>(tuple) == TrackedMoveOnly<2>{});
+    }
+}
@@ -0,0 +1,94 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/tuple_builder.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+#include <support/tracked_move_only.hpp>
+
+#include <type_traits>
+#include <utility>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto f = hana::test::_injection<0>{};
+
+    // unpack
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(hana::experimental::make_tuple_builder(), f),
+            f()
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(hana::experimental::make_tuple_builder(ct_eq<0>{}), f),
+            f(ct_eq<0>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(hana::experimental::make_tuple_builder(ct_eq<0>{}, ct_eq<1>{}), f),
+            f(ct_eq<0>{}, ct_eq<1>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(hana::experimental::make_tuple_builder(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}), f),
+            f(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(hana::empty<hana::experimental::tuple_builder_tag>(), f),
+            f()
+        ));
+    }
+
+    // length does not look at the elements
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::length(hana::experimental::make_tuple_builder()),
+            hana::size_c<0>
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::length(hana::experimental::make_tuple_builder(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})),
+            hana::size_c<3>
+        ));
+    }
+
+    // conversion to Sequences
+    {
+        auto builder = hana::experimental::make_tuple_builder(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::to_tuple(builder),
+            hana::make_tuple(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})
+        ));
+        static_assert(std::is_same<
+            decltype(hana::to<hana::basic_tuple_tag>(builder)),
+            hana::basic_tuple<ct_eq<0>, ct_eq<1>, ct_eq<2>>
+        >{}, "");
+    }
+
+    // in constant expressions
+    {
+        constexpr auto builder = hana::experimental::make_tuple_builder(1, '2', 3.0);
+        constexpr auto tuple = hana::to_tuple(builder);
+        static_assert(hana::at_c<0>(tuple) == 1, "");
+        static_assert(hana::at_c<1>(tuple) == '2', "");
+        static_assert(hana::at_c<2>(tuple) == 3.0, "");
+    }
+
+    // the elements are moved out of rvalue builders
+    {
+        auto builder = hana::experimental::make_tuple_builder(
+            TrackedMoveOnly<0>{}, TrackedMoveOnly<1>{}
+        );
+        auto tuple = hana::to_tuple(std::move(builder));
+        BOOST_HANA_CONSTANT_CHECK(hana::at_c<0>(tuple) == TrackedMoveOnly<0>{});
+        BOOST_HANA_CONSTANT_CHECK(hana::at_c<1>(tuple) == TrackedMoveOnly<1>{});
+    }
+}
@@ -0,0 +1,86 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/type_switch.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+namespace hana = boost::hana;
+
+
+// A minimal type-erased holder for the types used below.
+struct holder {
+    std::type_info const* type;
+    void* object;
+
+    template <typename T>
+    explicit holder(T& t) : type{&typeid(T)}, object{&t} { }
+
+    template <typename T>
+    T& get(hana::basic_type<T>) const { return *static_cast<T*>(object); }
+};
+
+int main() {
+    auto sw = hana::experimental::type_switch(hana::make_tuple(
+        hana::make_pair(hana::type_c<int>, [](int i) -> int { return i + 1; }),
+        hana::make_pair(hana::type_c<char>, [](char c) -> long { return c; }),
+        hana::make_pair(hana::type_c<std::string>, [](std::string& s) -> short {
+            s += '!';
+            return static_cast<short>(s.size());
+        })
+    ));
+
+    auto call = [&](holder h, auto otherwise) {
+        return sw(*h.type, [&](auto t) -> auto& { return h.get(t); }, otherwise);
+    };
+
+    // the result is the common type of all the handlers and the default
+    {
+        int i = 0;
+        auto result = call(holder{i}, []() -> long long { return -1; });
+        static_assert(std::is_same<decltype(result), long long>{}, "");
+    }
+
+    // the handler matching the runtime type is called
+    {
+        int i = 41;
+        BOOST_HANA_RUNTIME_CHECK(call(holder{i}, [] { return -1; }) == 42);
+
+        char c = 'x';
+        BOOST_HANA_RUNTIME_CHECK(call(holder{c}, [] { return -1; }) == 'x');
+
+        std::string s = "abc";
+        BOOST_HANA_RUNTIME_CHECK(call(holder{s}, [] { return -1; }) == 4);
+        BOOST_HANA_RUNTIME_CHECK(s == "abc!");
+    }
+
+    // the default is called when no case matches
+    {
+        double d = 3.5;
+        BOOST_HANA_RUNTIME_CHECK(call(holder{d}, [] { return -1; }) == -1);
+    }
+
+    // handlers may return void
+    {
+        int calls = 0;
+        auto sw = hana::experimental::type_switch(hana::make_tuple(
+            hana::make_pair(hana::type_c<int>, [&](int) { ++calls; }),
+            hana::make_pair(hana::type_c<char>, [&](char) { calls += 10; })
+        ));
+        int i = 0;
+        holder h{i};
+        sw(*h.type, [&](auto t) -> auto& { return h.get(t); }, [&] { calls += 100; });
+        BOOST_HANA_RUNTIME_CHECK(calls == 1);
+
+        double d = 0;
+        holder h2{d};
+        sw(*h2.type, [&](auto t) -> auto& { return h2.get(t); }, [&] { calls += 100; });
+        BOOST_HANA_RUNTIME_CHECK(calls == 101);
+    }
+}
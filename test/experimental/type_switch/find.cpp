@@ -0,0 +1,74 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/type_switch.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct x { };
+
+struct ignore { template <typename T> void operator()(T const&) const { } };
+
+int main() {
+    {
+        auto sw = hana::experimental::type_switch(hana::make_tuple(
+            hana::make_pair(hana::type_c<int>, ignore{})
+        ));
+        static_assert(decltype(sw)::size() == 1, "");
+        BOOST_HANA_RUNTIME_CHECK(sw.find(typeid(int)) == 0);
+        BOOST_HANA_RUNTIME_CHECK(sw.find(typeid(char)) == 1);
+        BOOST_HANA_RUNTIME_CHECK(sw.find(typeid(int const*)) == 1);
+    }
+
+    {
+        auto sw = hana::experimental::type_switch(hana::make_tuple(
+            hana::make_pair(hana::type_c<int>, ignore{}),
+            hana::make_pair(hana::type_c<char>, ignore{}),
+            hana::make_pair(hana::type_c<std::string>, ignore{}),
+            hana::make_pair(hana::type_c<std::vector<int>>, ignore{})
+        ));
+        static_assert(decltype(sw)::size() == 4, "");
+        BOOST_HANA_RUNTIME_CHECK(sw.find(typeid(int)) == 0);
+        BOOST_HANA_RUNTIME_CHECK(sw.find(typeid(char)) == 1);
+        BOOST_HANA_RUNTIME_CHECK(sw.find(typeid(std::string)) == 2);
+        BOOST_HANA_RUNTIME_CHECK(sw.find(typeid(std::vector<int>)) == 3);
+        BOOST_HANA_RUNTIME_CHECK(sw.find(typeid(std::vector<char>)) == 4);
+        BOOST_HANA_RUNTIME_CHECK(sw.find(std::type_index{typeid(long)}) == 4);
+    }
+
+    // more cases than a single probe of the table would cover
+    {
+        auto sw = hana::experimental::type_switch(hana::make_tuple(
+            hana::make_pair(hana::type_c<x<0>>, ignore{}), hana::make_pair(hana::type_c<x<1>>, ignore{}),
+            hana::make_pair(hana::type_c<x<2>>, ignore{}), hana::make_pair(hana::type_c<x<3>>, ignore{}),
+            hana::make_pair(hana::type_c<x<4>>, ignore{}), hana::make_pair(hana::type_c<x<5>>, ignore{}),
+            hana::make_pair(hana::type_c<x<6>>, ignore{}), hana::make_pair(hana::type_c<x<7>>, ignore{}),
+            hana::make_pair(hana::type_c<x<8>>, ignore{}), hana::make_pair(hana::type_c<x<9>>, ignore{}),
+            hana::make_pair(hana::type_c<x<10>>, ignore{}), hana::make_pair(hana::type_c<x<11>>, ignore{}),
+            hana::make_pair(hana::type_c<x<12>>, ignore{}), hana::make_pair(hana::type_c<x<13>>, ignore{}),
+            hana::make_pair(hana::type_c<x<14>>, ignore{}), hana::make_pair(hana::type_c<x<15>>, ignore{}),
+            hana::make_pair(hana::type_c<x<16>>, ignore{})
+        ));
+        std::type_info const* types[] = {
+            &typeid(x<0>), &typeid(x<1>), &typeid(x<2>), &typeid(x<3>),
+            &typeid(x<4>), &typeid(x<5>), &typeid(x<6>), &typeid(x<7>),
+            &typeid(x<8>), &typeid(x<9>), &typeid(x<10>), &typeid(x<11>),
+            &typeid(x<12>), &typeid(x<13>), &typeid(x<14>), &typeid(x<15>),
+            &typeid(x<16>)
+        };
+        for (std::size_t i = 0; i != 17; ++i)
+            BOOST_HANA_RUNTIME_CHECK(sw.find(*types[i]) == i);
+        BOOST_HANA_RUNTIME_CHECK(sw.find(typeid(x<17>)) == 17);
+    }
+}
@@ -0,0 +1,51 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/none_of.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/not.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+template <int> struct x;
+struct undefined { };
+
+template <typename T>
+struct is_even;
+
+template <int i>
+struct is_even<x<i>> : std::integral_constant<bool, i % 2 == 0> { };
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::none_of(
+        hana::experimental::types<>{}, undefined{}
+    ));
+
+    // with a Metafunction
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::none_of(
+            hana::experimental::types<x<0>>{}, hana::metafunction<is_even>
+        )));
+        BOOST_HANA_CONSTANT_CHECK(hana::none_of(
+            hana::experimental::types<x<1>>{}, hana::metafunction<is_even>
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::none_of(
+            hana::experimental::types<x<1>, x<2>, x<3>>{}, hana::metafunction<is_even>
+        )));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::none_of(
+            hana::experimental::types<x<0>, x<2>, x<4>>{}, hana::metafunction<is_even>
+        )));
+    }
+
+    // with a non-Metafunction
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::none_of(
+            hana::experimental::types<x<1>, x<3>, x<5>>{}, hana::trait<is_even>
+        ));
+    }
+}
@@ -0,0 +1,60 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/partition.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+template <int> struct x;
+struct undefined { };
+
+template <typename T>
+struct is_even;
+
+template <int i>
+struct is_even<x<i>> : std::integral_constant<bool, i % 2 == 0> { };
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::partition(hana::experimental::types<>{}, undefined{}),
+        hana::make_pair(hana::experimental::types<>{}, hana::experimental::types<>{})
+    ));
+
+    // with a Metafunction
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::partition(hana::experimental::types<x<0>>{}, hana::metafunction<is_even>),
+            hana::make_pair(hana::experimental::types<x<0>>{},
+                            hana::experimental::types<>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::partition(hana::experimental::types<x<1>>{}, hana::metafunction<is_even>),
+            hana::make_pair(hana::experimental::types<>{},
+                            hana::experimental::types<x<1>>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::partition(hana::experimental::types<x<3>, x<0>, x<1>, x<4>, x<2>>{},
+                            hana::metafunction<is_even>),
+            hana::make_pair(hana::experimental::types<x<0>, x<4>, x<2>>{},
+                            hana::experimental::types<x<3>, x<1>>{})
+        ));
+    }
+
+    // with a non-Metafunction
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::partition(hana::experimental::types<x<3>, x<0>, x<1>, x<4>, x<2>>{},
+                            hana::trait<is_even>),
+            hana::make_pair(hana::experimental::types<x<0>, x<4>, x<2>>{},
+                            hana::experimental::types<x<3>, x<1>>{})
+        ));
+    }
+}
@@ -0,0 +1,94 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/sort.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+template <int> struct x;
+struct undefined { };
+
+template <typename T, typename U>
+struct less;
+
+template <int i, int j>
+struct less<x<i>, x<j>> : std::integral_constant<bool, (i < j)> { };
+
+// Compares only the tens, to check the stability of the sort.
+template <typename T, typename U>
+struct less_tens;
+
+template <int i, int j>
+struct less_tens<x<i>, x<j>> : std::integral_constant<bool, (i / 10 < j / 10)> { };
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sort(hana::experimental::types<>{}, undefined{}),
+        hana::experimental::types<>{}
+    ));
+
+    // with a Metafunction
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(hana::experimental::types<x<0>>{}, hana::metafunction<less>),
+            hana::experimental::types<x<0>>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(hana::experimental::types<x<0>, x<1>>{}, hana::metafunction<less>),
+            hana::experimental::types<x<0>, x<1>>{}
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(hana::experimental::types<x<1>, x<0>>{}, hana::metafunction<less>),
+            hana::experimental::types<x<0>, x<1>>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(hana::experimental::types<x<2>, x<0>, x<3>, x<1>>{},
+                       hana::metafunction<less>),
+            hana::experimental::types<x<0>, x<1>, x<2>, x<3>>{}
+        ));
+
+        // more than 8 elements, which uses the merge sort
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(hana::experimental::types<x<7>, x<3>, x<9>, x<0>, x<5>,
+                                                 x<1>, x<8>, x<2>, x<6>, x<4>>{},
+                       hana::metafunction<less>),
+            hana::experimental::types<x<0>, x<1>, x<2>, x<3>, x<4>,
+                                      x<5>, x<6>, x<7>, x<8>, x<9>>{}
+        ));
+
+        // the sort is stable
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(hana::experimental::types<x<21>, x<10>, x<20>, x<11>, x<0>>{},
+                       hana::metafunction<less_tens>),
+            hana::experimental::types<x<0>, x<10>, x<11>, x<21>, x<20>>{}
+        ));
+    }
+
+    // with a non-Metafunction
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(hana::experimental::types<x<2>, x<0>, x<3>, x<1>>{},
+                       hana::trait<less>),
+            hana::experimental::types<x<0>, x<1>, x<2>, x<3>>{}
+        ));
+
+        auto greater = [](auto t, auto u) {
+            return hana::bool_c<less<typename decltype(u)::type,
+                                     typename decltype(t)::type>::value>;
+        };
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(hana::experimental::types<x<2>, x<0>, x<3>, x<1>>{}, greater),
+            hana::experimental::types<x<3>, x<2>, x<1>, x<0>>{}
+        ));
+    }
+}
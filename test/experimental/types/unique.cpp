@@ -0,0 +1,84 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/type.hpp>
+#include <boost/hana/unique.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+template <int> struct x;
+struct undefined { };
+
+template <typename T, typename U>
+struct same_tens;
+
+template <int i, int j>
+struct same_tens<x<i>, x<j>> : std::integral_constant<bool, i / 10 == j / 10> { };
+
+int main() {
+    // without a predicate
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unique(hana::experimental::types<>{}),
+            hana::experimental::types<>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unique(hana::experimental::types<x<0>>{}),
+            hana::experimental::types<x<0>>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unique(hana::experimental::types<x<0>, x<0>>{}),
+            hana::experimental::types<x<0>>{}
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unique(hana::experimental::types<x<0>, x<1>>{}),
+            hana::experimental::types<x<0>, x<1>>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unique(hana::experimental::types<x<0>, x<0>, x<1>, x<0>, x<0>, x<0>, x<2>>{}),
+            hana::experimental::types<x<0>, x<1>, x<0>, x<2>>{}
+        ));
+    }
+
+    // with a Metafunction
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unique(hana::experimental::types<>{}, undefined{}),
+            hana::experimental::types<>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unique(hana::experimental::types<x<0>>{}, hana::metafunction<same_tens>),
+            hana::experimental::types<x<0>>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unique(hana::experimental::types<x<0>, x<1>, x<10>, x<2>, x<22>, x<21>>{},
+                         hana::metafunction<same_tens>),
+            hana::experimental::types<x<0>, x<10>, x<2>, x<22>>{}
+        ));
+    }
+
+    // with a non-Metafunction
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unique(hana::experimental::types<x<0>, x<1>, x<10>, x<2>, x<22>, x<21>>{},
+                         hana::trait<same_tens>),
+            hana::experimental::types<x<0>, x<10>, x<2>, x<22>>{}
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unique(hana::experimental::types<x<0>, x<0>, x<1>, x<1>>{}, hana::equal),
+            hana::experimental::types<x<0>, x<1>>{}
+        ));
+    }
+}
@@ -0,0 +1,66 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+struct odd {
+    template <int i>
+    constexpr auto operator()(ct_eq<i> const&) const
+    { return hana::bool_c<i % 2 == 1>; }
+};
+
+struct counted {
+    int* calls;
+    template <typename X>
+    X operator()(X x) const { ++*calls; return x; }
+};
+
+int main() {
+    auto container = ::seq;
+
+    {
+        auto storage = container(ct_eq<1>{});
+        auto filtered = hana::experimental::filtered(storage, odd{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(filtered, hana::size_c<0>),
+            ct_eq<1>{}
+        ));
+    }{
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{}, ct_eq<4>{});
+        auto filtered = hana::experimental::filtered(storage, odd{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(filtered, hana::size_c<0>),
+            ct_eq<1>{}
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(filtered, hana::size_c<1>),
+            ct_eq<3>{}
+        ));
+    }
+
+    // Make sure filtering a transformed view does not evaluate the function
+    {
+        int calls = 0;
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto transformed = hana::experimental::transformed(storage, counted{&calls});
+        auto filtered = hana::experimental::filtered(transformed, odd{});
+        BOOST_HANA_RUNTIME_CHECK(calls == 0);
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(filtered, hana::size_c<0>),
+            ct_eq<1>{}
+        ));
+        BOOST_HANA_RUNTIME_CHECK(calls == 1);
+    }
+}
@@ -0,0 +1,82 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/filter.hpp>
+#include <boost/hana/functional/always.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+struct odd {
+    template <int i>
+    constexpr auto operator()(ct_eq<i> const&) const
+    { return hana::bool_c<i % 2 == 1>; }
+};
+
+int main() {
+    auto container = ::seq;
+    auto f = hana::test::_injection<0>{};
+
+    {
+        auto storage = container();
+        auto filtered = hana::experimental::filtered(storage, odd{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(filtered, f),
+            f()
+        ));
+    }{
+        auto storage = container(ct_eq<0>{});
+        auto filtered = hana::experimental::filtered(storage, odd{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(filtered, f),
+            f()
+        ));
+    }{
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{});
+        auto filtered = hana::experimental::filtered(storage, odd{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(filtered, f),
+            f(ct_eq<1>{})
+        ));
+    }{
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{}, ct_eq<5>{});
+        auto filtered = hana::experimental::filtered(storage, odd{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(filtered, f),
+            f(ct_eq<1>{}, ct_eq<3>{}, ct_eq<5>{})
+        ));
+    }{
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto filtered = hana::experimental::filtered(storage, hana::always(hana::true_c));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(filtered, f),
+            f(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})
+        ));
+    }
+
+    // hana::filter on a view returns a filtered view
+    {
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{});
+        auto transformed = hana::experimental::transformed(storage, hana::test::_injection<1>{});
+        auto filtered = hana::filter(transformed, hana::always(hana::true_c));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(filtered, f),
+            f(hana::test::_injection<1>{}(ct_eq<0>{}), hana::test::_injection<1>{}(ct_eq<1>{}),
+              hana::test::_injection<1>{}(ct_eq<2>{}), hana::test::_injection<1>{}(ct_eq<3>{}))
+        ));
+
+        auto none = hana::filter(transformed, hana::always(hana::false_c));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(none, f),
+            f()
+        ));
+    }
+}
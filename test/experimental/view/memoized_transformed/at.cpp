@@ -0,0 +1,60 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/is_empty.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/not.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+    auto f = hana::test::_injection<0>{};
+
+    {
+        auto storage = container(ct_eq<0>{});
+        auto memoized = hana::experimental::memoized_transformed(storage, f);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(memoized, hana::size_c<0>),
+            f(ct_eq<0>{})
+        ));
+    }{
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto memoized = hana::experimental::memoized_transformed(storage, f);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(memoized, hana::size_c<0>),
+            f(ct_eq<0>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(memoized, hana::size_c<1>),
+            f(ct_eq<1>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(memoized, hana::size_c<2>),
+            f(ct_eq<2>{})
+        ));
+    }
+
+    // length and is_empty
+    {
+        auto storage = container();
+        auto memoized = hana::experimental::memoized_transformed(storage, f);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::length(memoized), hana::size_c<0>));
+        BOOST_HANA_CONSTANT_CHECK(hana::is_empty(memoized));
+    }{
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{});
+        auto memoized = hana::experimental::memoized_transformed(storage, f);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::length(memoized), hana::size_c<2>));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::is_empty(memoized)));
+    }
+}
@@ -0,0 +1,70 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/transform.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+
+
+struct counted {
+    int* calls;
+
+    std::string operator()(int i) const {
+        ++*calls;
+        return std::string(static_cast<std::size_t>(i), 'x');
+    }
+};
+
+struct total_size {
+    template <typename ...S>
+    std::size_t operator()(S const& ...s) const {
+        std::size_t result = 0;
+        int expand[] = {0, ((void)(result += s.size()), 0)...};
+        (void)expand;
+        return result;
+    }
+};
+
+int main() {
+    int calls = 0;
+    auto ints = hana::make_tuple(1, 2, 3);
+    auto memoized = hana::experimental::memoized_transformed(ints, counted{&calls});
+
+    // Nothing is computed upfront
+    BOOST_HANA_RUNTIME_CHECK(calls == 0);
+
+    // Each element is computed when it is first accessed, and only then
+    BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(memoized) == "xx");
+    BOOST_HANA_RUNTIME_CHECK(calls == 1);
+    BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(memoized) == "xx");
+    BOOST_HANA_RUNTIME_CHECK(calls == 1);
+
+    BOOST_HANA_RUNTIME_CHECK(hana::unpack(memoized, total_size{}) == 6);
+    BOOST_HANA_RUNTIME_CHECK(calls == 3);
+    BOOST_HANA_RUNTIME_CHECK(hana::unpack(memoized, total_size{}) == 6);
+    BOOST_HANA_RUNTIME_CHECK(calls == 3);
+
+    // The same object is returned every time
+    BOOST_HANA_RUNTIME_CHECK(&hana::at_c<0>(memoized) == &hana::at_c<0>(memoized));
+
+    // Copies of the view, including the ones held by other views, share the cache
+    auto copy = memoized;
+    BOOST_HANA_RUNTIME_CHECK(hana::at_c<2>(copy) == "xxx");
+    BOOST_HANA_RUNTIME_CHECK(calls == 3);
+
+    auto lengths = hana::transform(memoized, [](std::string const& s) {
+        return s.size();
+    });
+    BOOST_HANA_RUNTIME_CHECK(hana::fold_left(lengths, 0u, [](auto a, auto b) {
+        return a + b;
+    }) == 6u);
+    BOOST_HANA_RUNTIME_CHECK(calls == 3);
+}
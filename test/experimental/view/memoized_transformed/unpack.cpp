@@ -0,0 +1,51 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+    auto f = hana::test::_injection<0>{};
+    auto g = hana::test::_injection<1>{};
+
+    {
+        auto storage = container();
+        auto memoized = hana::experimental::memoized_transformed(storage, g);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(memoized, f),
+            f()
+        ));
+    }{
+        auto storage = container(ct_eq<0>{});
+        auto memoized = hana::experimental::memoized_transformed(storage, g);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(memoized, f),
+            f(g(ct_eq<0>{}))
+        ));
+    }{
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto memoized = hana::experimental::memoized_transformed(storage, g);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(memoized, f),
+            f(g(ct_eq<0>{}), g(ct_eq<1>{}), g(ct_eq<2>{}))
+        ));
+    }{
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto reversed = hana::experimental::reversed(storage);
+        auto memoized = hana::experimental::memoized_transformed(reversed, g);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(memoized, f),
+            f(g(ct_eq<2>{}), g(ct_eq<1>{}), g(ct_eq<0>{}))
+        ));
+    }
+}
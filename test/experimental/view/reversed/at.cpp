@@ -0,0 +1,52 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+
+    {
+        auto storage = container(ct_eq<0>{});
+        auto reversed = hana::experimental::reversed(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(reversed, hana::size_c<0>),
+            ct_eq<0>{}
+        ));
+    }{
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto reversed = hana::experimental::reversed(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(reversed, hana::size_c<0>),
+            ct_eq<2>{}
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(reversed, hana::size_c<1>),
+            ct_eq<1>{}
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(reversed, hana::size_c<2>),
+            ct_eq<0>{}
+        ));
+    }
+
+    // the elements are not copied
+    {
+        auto storage = hana::make_tuple(1, 2, 3);
+        auto reversed = hana::experimental::reversed(storage);
+        hana::at_c<0>(reversed) = 30;
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<2>(storage) == 30);
+    }
+}
@@ -0,0 +1,38 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/is_empty.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/not.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+
+    {
+        auto storage = container();
+        auto reversed = hana::experimental::reversed(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::length(reversed), hana::size_c<0>));
+        BOOST_HANA_CONSTANT_CHECK(hana::is_empty(reversed));
+    }{
+        auto storage = container(ct_eq<0>{});
+        auto reversed = hana::experimental::reversed(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::length(reversed), hana::size_c<1>));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::is_empty(reversed)));
+    }{
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto reversed = hana::experimental::reversed(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::length(reversed), hana::size_c<3>));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::is_empty(reversed)));
+    }
+}
@@ -0,0 +1,102 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/filter.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/transform.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+// Counts the number of live objects, and the maximum number of objects
+// that were alive at the same time.
+struct live {
+    static int count, max;
+    int value;
+
+    explicit live(int v) : value(v) { bump(); }
+    live(live const& other) : value(other.value) { bump(); }
+    ~live() { --count; }
+
+    static void bump() { if (++count > max) max = count; }
+};
+int live::count = 0;
+int live::max = 0;
+
+struct to_live {
+    live operator()(int i) const { return live{i}; }
+    char operator()(char c) const { return c; }
+};
+
+struct is_live {
+    template <typename T>
+    constexpr auto operator()(T const&) const
+    { return hana::bool_c<std::is_same<T, live>::value>; }
+};
+
+int main() {
+    auto container = ::seq;
+    auto f = hana::test::_injection<0>{};
+    auto g = hana::test::_injection<1>{};
+
+    // with state
+    {
+        auto storage = container();
+        auto transformed = hana::experimental::transformed(storage, g);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::fold_left(transformed, ct_eq<9>{}, f),
+            ct_eq<9>{}
+        ));
+    }{
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto transformed = hana::experimental::transformed(storage, g);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::fold_left(transformed, ct_eq<9>{}, f),
+            f(f(f(ct_eq<9>{}, g(ct_eq<0>{})), g(ct_eq<1>{})), g(ct_eq<2>{}))
+        ));
+    }
+
+    // without state
+    {
+        auto storage = container(ct_eq<0>{});
+        auto transformed = hana::experimental::transformed(storage, g);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::fold_left(transformed, f),
+            g(ct_eq<0>{})
+        ));
+    }{
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto transformed = hana::experimental::transformed(storage, g);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::fold_left(transformed, f),
+            f(f(g(ct_eq<0>{}), g(ct_eq<1>{})), g(ct_eq<2>{}))
+        ));
+    }
+
+    // A chain of views is folded one element at a time
+    {
+        auto ints = hana::make_tuple(1, 'x', 2, 3, 'y', 4);
+        auto chain = hana::transform(
+            hana::filter(hana::experimental::transformed(ints, to_live{}), is_live{}),
+            [](live const& l) { return live{l.value * 10}; }
+        );
+
+        live::max = 0;
+        int sum = hana::fold_left(chain, 0, [](int state, live const& l) {
+            return state + l.value;
+        });
+        BOOST_HANA_RUNTIME_CHECK(sum == 100);
+        BOOST_HANA_RUNTIME_CHECK(live::count == 0);
+        BOOST_HANA_RUNTIME_CHECK(live::max <= 2);
+    }
+}
@@ -0,0 +1,70 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/transform.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+
+#include <vector>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+struct live {
+    static int count, max;
+    int value;
+
+    explicit live(int v) : value(v) { bump(); }
+    live(live const& other) : value(other.value) { bump(); }
+    ~live() { --count; }
+
+    static void bump() { if (++count > max) max = count; }
+};
+int live::count = 0;
+int live::max = 0;
+
+int main() {
+    auto container = ::seq;
+
+    {
+        std::vector<int> seen;
+        auto storage = container();
+        auto transformed = hana::experimental::transformed(storage, [](auto) { return 0; });
+        hana::for_each(transformed, [&](int i) { seen.push_back(i); });
+        BOOST_HANA_RUNTIME_CHECK(seen.empty());
+    }
+
+    // The elements are visited in order, and one at a time
+    {
+        std::vector<int> seen;
+        auto ints = hana::make_tuple(1, 2, 3, 4);
+        auto transformed = hana::experimental::transformed(ints, [](int i) {
+            return live{i};
+        });
+        auto reversed = hana::experimental::reversed(transformed);
+        auto chain = hana::transform(reversed, [](live const& l) {
+            return live{l.value + 10};
+        });
+
+        live::max = 0;
+        hana::for_each(chain, [&](live const& l) { seen.push_back(l.value); });
+        BOOST_HANA_RUNTIME_CHECK(seen == std::vector<int>{14, 13, 12, 11});
+        BOOST_HANA_RUNTIME_CHECK(live::count == 0);
+        BOOST_HANA_RUNTIME_CHECK(live::max <= 2);
+    }
+
+    // The function is applied to lvalues of the underlying sequence
+    {
+        auto ints = hana::make_tuple(1, 2, 3);
+        auto sliced = hana::experimental::sliced(ints, hana::tuple_c<int, 0, 2>);
+        hana::for_each(sliced, [](int& i) { i *= 10; });
+        BOOST_HANA_RUNTIME_CHECK(ints == hana::make_tuple(10, 2, 30));
+    }
+}
@@ -0,0 +1,55 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+
+    {
+        auto storage1 = container(ct_eq<0>{}, ct_eq<1>{});
+        auto storage2 = container(ct_eq<2>{}, ct_eq<3>{});
+        auto zipped = hana::experimental::zipped(storage1, storage2);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::to_tuple(hana::at(zipped, hana::size_c<0>)),
+            hana::make_tuple(ct_eq<0>{}, ct_eq<2>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::to_tuple(hana::at(zipped, hana::size_c<1>)),
+            hana::make_tuple(ct_eq<1>{}, ct_eq<3>{})
+        ));
+    }
+
+    // the elements of the zipped sequences are not copied
+    {
+        auto ints = hana::make_tuple(1, 2);
+        auto chars = hana::make_tuple('a', 'b');
+        auto zipped = hana::experimental::zipped(ints, chars);
+        static_assert(std::is_same<
+            decltype(hana::at_c<1>(zipped)),
+            hana::basic_tuple<int&, char&>
+        >{}, "");
+
+        auto second = hana::at_c<1>(zipped);
+        hana::at_c<0>(second) = 20;
+        hana::at_c<1>(second) = 'c';
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(ints) == 20);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(chars) == 'c');
+    }
+}
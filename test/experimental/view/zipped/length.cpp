@@ -0,0 +1,40 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/is_empty.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/not.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+
+    {
+        auto storage1 = container();
+        auto storage2 = container();
+        auto zipped = hana::experimental::zipped(storage1, storage2);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::length(zipped), hana::size_c<0>));
+        BOOST_HANA_CONSTANT_CHECK(hana::is_empty(zipped));
+    }{
+        auto storage = container(ct_eq<0>{});
+        auto zipped = hana::experimental::zipped(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::length(zipped), hana::size_c<1>));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::is_empty(zipped)));
+    }{
+        auto storage1 = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto storage2 = container(ct_eq<3>{}, ct_eq<4>{}, ct_eq<5>{});
+        auto zipped = hana::experimental::zipped(storage1, storage2);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::length(zipped), hana::size_c<3>));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::is_empty(zipped)));
+    }
+}
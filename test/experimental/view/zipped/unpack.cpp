@@ -0,0 +1,79 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+// Turns the basic_tuples of a zipped view into tuples, which are Comparable.
+struct to_tuples {
+    template <typename ...Xs>
+    constexpr auto operator()(Xs const& ...xs) const
+    { return hana::make_tuple(hana::to_tuple(xs)...); }
+};
+
+int main() {
+    auto container = ::seq;
+
+    {
+        auto storage = container();
+        auto zipped = hana::experimental::zipped(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(zipped, to_tuples{}),
+            hana::make_tuple()
+        ));
+    }{
+        auto storage1 = container();
+        auto storage2 = container();
+        auto zipped = hana::experimental::zipped(storage1, storage2);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(zipped, to_tuples{}),
+            hana::make_tuple()
+        ));
+    }{
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{});
+        auto zipped = hana::experimental::zipped(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(zipped, to_tuples{}),
+            hana::make_tuple(hana::make_tuple(ct_eq<0>{}), hana::make_tuple(ct_eq<1>{}))
+        ));
+    }{
+        auto storage1 = container(ct_eq<0>{}, ct_eq<1>{});
+        auto storage2 = container(ct_eq<2>{}, ct_eq<3>{});
+        auto storage3 = container(ct_eq<4>{}, ct_eq<5>{});
+        auto zipped = hana::experimental::zipped(storage1, storage2, storage3);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(zipped, to_tuples{}),
+            hana::make_tuple(
+                hana::make_tuple(ct_eq<0>{}, ct_eq<2>{}, ct_eq<4>{}),
+                hana::make_tuple(ct_eq<1>{}, ct_eq<3>{}, ct_eq<5>{})
+            )
+        ));
+    }
+
+    // zipping views
+    {
+        auto storage1 = container(ct_eq<0>{}, ct_eq<1>{});
+        auto storage2 = container(ct_eq<2>{}, ct_eq<3>{});
+        auto reversed = hana::experimental::reversed(storage2);
+        auto transformed = hana::experimental::transformed(storage1, hana::test::_injection<0>{});
+        auto zipped = hana::experimental::zipped(transformed, reversed);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(zipped, to_tuples{}),
+            hana::make_tuple(
+                hana::make_tuple(hana::test::_injection<0>{}(ct_eq<0>{}), ct_eq<3>{}),
+                hana::make_tuple(hana::test::_injection<0>{}(ct_eq<1>{}), ct_eq<2>{})
+            )
+        ));
+    }
+}
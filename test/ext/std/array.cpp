@@ -5,6 +5,7 @@
 #include <boost/hana/assert.hpp>
 #include <boost/hana/ext/std/array.hpp>
 #include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
 
 #include <laws/base.hpp>
 #include <laws/comparable.hpp>
@@ -14,6 +15,8 @@
 #include <laws/searchable.hpp>
 
 #include <array>
+#include <memory>
+#include <utility>
 using namespace boost::hana;
 
 
@@ -51,6 +54,18 @@ int main() {
     //////////////////////////////////////////////////////////////////////////
     test::TestFoldable<ext::std::array_tag>{int_arrays};
 
+    // unpack forwards the elements with the value category of the array
+    {
+        std::array<std::unique_ptr<int>, 2> ptrs{{
+            std::make_unique<int>(1), std::make_unique<int>(2)
+        }};
+        int sum = unpack(std::move(ptrs), [](std::unique_ptr<int> a, std::unique_ptr<int> b) {
+            return *a + *b;
+        });
+        BOOST_HANA_RUNTIME_CHECK(sum == 3);
+        BOOST_HANA_RUNTIME_CHECK(ptrs[0] == nullptr && ptrs[1] == nullptr);
+    }
+
 #elif BOOST_HANA_TEST_PART == 4
     //////////////////////////////////////////////////////////////////////////
     // Iterable
@@ -0,0 +1,94 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/concept/foldable.hpp>
+#include <boost/hana/ext/std/vector.hpp>
+#include <boost/hana/fold.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/fold_right.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/reverse_fold.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+namespace hana = boost::hana;
+
+
+// The length of a vector is not known at compile-time, so it is not
+// Foldable, even though it provides some of the folds.
+static_assert(!hana::Foldable<std::vector<int>>::value, "");
+
+int main() {
+    std::vector<std::string> v{"a", "b", "c"};
+
+    // fold_left
+    {
+        auto f = [](std::string s, std::string const& x) { return "(" + s + x + ")"; };
+        BOOST_HANA_RUNTIME_CHECK(hana::fold_left(v, std::string{"s"}, f) == "(((sa)b)c)");
+        BOOST_HANA_RUNTIME_CHECK(hana::fold_left(v, f) == "((ab)c)");
+        BOOST_HANA_RUNTIME_CHECK(hana::fold(v, std::string{"s"}, f) == "(((sa)b)c)");
+        BOOST_HANA_RUNTIME_CHECK(hana::fold_left(std::vector<std::string>{}, std::string{"s"}, f) == "s");
+
+        // the type of the state is the type returned by the function
+        std::vector<int> ints{1, 2, 3};
+        auto sum = hana::fold_left(ints, 0, [](long long s, int x) { return s + x; });
+        static_assert(std::is_same<decltype(sum), long long>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(sum == 6);
+    }
+
+    // fold_right
+    {
+        auto f = [](std::string const& x, std::string s) { return "(" + x + s + ")"; };
+        BOOST_HANA_RUNTIME_CHECK(hana::fold_right(v, std::string{"s"}, f) == "(a(b(cs)))");
+        BOOST_HANA_RUNTIME_CHECK(hana::fold_right(v, f) == "(a(bc))");
+        BOOST_HANA_RUNTIME_CHECK(hana::reverse_fold(v, std::string{"s"},
+            [](std::string s, std::string const& x) { return "(" + s + x + ")"; }
+        ) == "(((sc)b)a)");
+    }
+
+    // the folds without a state require a non-empty vector
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+    {
+        auto f = [](int x, int y) { return x + y; };
+        bool thrown = false;
+        try { hana::fold_left(std::vector<int>{}, f); }
+        catch (std::invalid_argument const&) { thrown = true; }
+        BOOST_HANA_RUNTIME_CHECK(thrown);
+
+        thrown = false;
+        try { hana::fold_right(std::vector<int>{}, f); }
+        catch (std::invalid_argument const&) { thrown = true; }
+        BOOST_HANA_RUNTIME_CHECK(thrown);
+
+        BOOST_HANA_RUNTIME_CHECK(hana::fold_left(std::vector<int>{4}, f) == 4);
+        BOOST_HANA_RUNTIME_CHECK(hana::fold_right(std::vector<int>{4}, f) == 4);
+    }
+#endif
+
+    // for_each
+    {
+        std::string result;
+        hana::for_each(v, [&](std::string const& x) { result += x; });
+        BOOST_HANA_RUNTIME_CHECK(result == "abc");
+
+        hana::for_each(v, [](std::string& x) { x += "!"; });
+        BOOST_HANA_RUNTIME_CHECK(v == std::vector<std::string>{"a!", "b!", "c!"});
+    }
+
+    // the elements of an rvalue are moved into the function
+    {
+        std::vector<std::unique_ptr<int>> ptrs;
+        ptrs.push_back(std::make_unique<int>(1));
+        ptrs.push_back(std::make_unique<int>(2));
+        int sum = hana::fold_left(std::move(ptrs), 0, [](int s, std::unique_ptr<int> p) {
+            return s + *p;
+        });
+        BOOST_HANA_RUNTIME_CHECK(sum == 3);
+        BOOST_HANA_RUNTIME_CHECK(ptrs[0] == nullptr && ptrs[1] == nullptr);
+    }
+}
@@ -9,7 +9,6 @@
 
 #include <laws/base.hpp>
 #include <laws/comparable.hpp>
-// #include <laws/functor.hpp>
 #include <laws/orderable.hpp>
 
 #include <vector>
@@ -25,8 +24,6 @@ int main() {
         , std::vector<test::eq<0>>{4}
     );
 
-    // auto eq_values = make<tuple_tag>(test::eq<0>{}, test::eq<2>{});
-
     auto ords = make_tuple(
           std::vector<test::ord<0>>{0}
         , std::vector<test::ord<0>>{1}
@@ -36,9 +33,8 @@ int main() {
     );
 
     //////////////////////////////////////////////////////////////////////////
-    // Comparable, Orderable, Functor
+    // Comparable, Orderable
     //////////////////////////////////////////////////////////////////////////
     test::TestComparable<ext::std::vector_tag>{eqs};
     test::TestOrderable<ext::std::vector_tag>{ords};
-    // test::TestFunctor<ext::std::vector_tag>{eqs, eq_values};
 }
@@ -0,0 +1,30 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/ext/std/vector.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <laws/functor.hpp>
+
+#include <vector>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    // The elements of a vector all have the same type, and ct_eq makes the
+    // result of comparing them known at compile-time, which the Functor
+    // laws require when the transformation changes the type of the elements.
+    auto vectors = hana::make_tuple(
+          std::vector<ct_eq<0>>{}
+        , std::vector<ct_eq<0>>{ct_eq<0>{}}
+        , std::vector<ct_eq<0>>{ct_eq<0>{}, ct_eq<0>{}}
+        , std::vector<ct_eq<0>>{ct_eq<0>{}, ct_eq<0>{}, ct_eq<0>{}}
+    );
+
+    auto values = hana::make_tuple(ct_eq<0>{}, ct_eq<1>{});
+
+    hana::test::TestFunctor<hana::ext::std::vector_tag>{vectors, values};
+}
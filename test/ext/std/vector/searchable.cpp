@@ -0,0 +1,44 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/all_of.hpp>
+#include <boost/hana/any_of.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/concept/searchable.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/ext/std/vector.hpp>
+#include <boost/hana/none_of.hpp>
+
+#include <vector>
+namespace hana = boost::hana;
+
+
+// A vector can't provide find_if, so it is not Searchable even though it
+// provides any_of and the algorithms based on it.
+static_assert(!hana::Searchable<std::vector<int>>::value, "");
+
+int main() {
+    std::vector<int> v{1, 2, 3};
+    auto is_even = [](int x) { return x % 2 == 0; };
+    auto is_positive = [](int x) { return x > 0; };
+
+    BOOST_HANA_RUNTIME_CHECK(hana::any_of(v, is_even));
+    BOOST_HANA_RUNTIME_CHECK(!hana::any_of(std::vector<int>{1, 3}, is_even));
+    BOOST_HANA_RUNTIME_CHECK(!hana::any_of(std::vector<int>{}, is_positive));
+
+    BOOST_HANA_RUNTIME_CHECK(hana::all_of(v, is_positive));
+    BOOST_HANA_RUNTIME_CHECK(!hana::all_of(v, is_even));
+    BOOST_HANA_RUNTIME_CHECK(hana::all_of(std::vector<int>{}, is_even));
+
+    BOOST_HANA_RUNTIME_CHECK(hana::none_of(std::vector<int>{1, 3}, is_even));
+    BOOST_HANA_RUNTIME_CHECK(!hana::none_of(v, is_even));
+
+    BOOST_HANA_RUNTIME_CHECK(hana::contains(v, 2));
+    BOOST_HANA_RUNTIME_CHECK(!hana::contains(v, 4));
+
+    // any_of stops at the first element satisfying the predicate
+    int calls = 0;
+    hana::any_of(v, [&](int x) { ++calls; return x == 1; });
+    BOOST_HANA_RUNTIME_CHECK(calls == 1);
+}
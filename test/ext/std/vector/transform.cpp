@@ -0,0 +1,66 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/ext/std/vector.hpp>
+#include <boost/hana/transform.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+namespace hana = boost::hana;
+
+
+int main() {
+    // lvalues are left untouched
+    {
+        std::vector<int> v{1, 2, 3};
+        std::vector<int> const& cv = v;
+        BOOST_HANA_RUNTIME_CHECK(hana::transform(v, [](int x) { return x * 2; })
+                                    == std::vector<int>{2, 4, 6});
+        BOOST_HANA_RUNTIME_CHECK(hana::transform(cv, [](int x) { return x + 1; })
+                                    == std::vector<int>{2, 3, 4});
+        BOOST_HANA_RUNTIME_CHECK(v == std::vector<int>{1, 2, 3});
+    }
+
+    // the type of the elements can change
+    {
+        std::vector<int> v{1, 2, 3};
+        std::vector<std::string> s = hana::transform(v, [](int x) {
+            return std::string(static_cast<std::size_t>(x), 'a');
+        });
+        BOOST_HANA_RUNTIME_CHECK(s == std::vector<std::string>{"a", "aa", "aaa"});
+    }
+
+    // the storage of an rvalue is reused when the type does not change
+    {
+        std::vector<std::string> v{"a", "b", "c"};
+        std::string const* data = v.data();
+        std::vector<std::string> w = hana::transform(std::move(v), [](std::string s) {
+            return s + s;
+        });
+        BOOST_HANA_RUNTIME_CHECK(w.data() == data);
+        BOOST_HANA_RUNTIME_CHECK(w == std::vector<std::string>{"aa", "bb", "cc"});
+    }
+
+    // the elements of an rvalue are moved into the function
+    {
+        std::vector<std::unique_ptr<int>> v;
+        v.push_back(std::make_unique<int>(1));
+        v.push_back(std::make_unique<int>(2));
+        std::vector<int> w = hana::transform(std::move(v), [](std::unique_ptr<int> p) {
+            return *p;
+        });
+        BOOST_HANA_RUNTIME_CHECK(w == std::vector<int>{1, 2});
+        BOOST_HANA_RUNTIME_CHECK(v[0] == nullptr && v[1] == nullptr);
+    }
+
+    // empty vectors
+    {
+        std::vector<int> v;
+        BOOST_HANA_RUNTIME_CHECK(hana::transform(v, [](int x) { return x * 2.0; }).empty());
+        BOOST_HANA_RUNTIME_CHECK(hana::transform(std::move(v), [](int x) { return x; }).empty());
+    }
+}
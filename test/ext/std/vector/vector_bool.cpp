@@ -0,0 +1,68 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/any_of.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/ext/std/vector.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/fold_right.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/transform.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+namespace hana = boost::hana;
+
+
+// std::vector<bool> returns proxies instead of references to its elements.
+int main() {
+    auto to_char = [](bool b) { return b ? 't' : 'f'; };
+    auto append = [=](std::string s, bool b) { return s + to_char(b); };
+    auto prepend = [=](bool b, std::string s) { return to_char(b) + s; };
+
+    // transform
+    {
+        std::vector<bool> v{true, false, true};
+        BOOST_HANA_RUNTIME_CHECK(hana::transform(v, to_char) == std::vector<char>{'t', 'f', 't'});
+        BOOST_HANA_RUNTIME_CHECK(hana::transform(std::vector<bool>{true, false}, to_char)
+                                    == std::vector<char>{'t', 'f'});
+
+        // in place
+        auto not_ = [](bool b) { return !b; };
+        BOOST_HANA_RUNTIME_CHECK(hana::transform(std::move(v), not_)
+                                    == std::vector<bool>{false, true, false});
+    }
+
+    // fold_left and fold_right
+    {
+        std::vector<bool> v{true, false, false};
+        BOOST_HANA_RUNTIME_CHECK(hana::fold_left(v, std::string{}, append) == "tff");
+        BOOST_HANA_RUNTIME_CHECK(hana::fold_left(std::vector<bool>{false, true}, std::string{}, append) == "ft");
+        BOOST_HANA_RUNTIME_CHECK(hana::fold_right(v, std::string{}, prepend) == "tff");
+        BOOST_HANA_RUNTIME_CHECK(hana::fold_right(std::vector<bool>{false, true}, std::string{}, prepend) == "ft");
+
+        auto xor_ = [](bool a, bool b) { return a != b; };
+        BOOST_HANA_RUNTIME_CHECK(hana::fold_left(v, xor_) == true);
+        BOOST_HANA_RUNTIME_CHECK(hana::fold_right(std::vector<bool>{true, true}, xor_) == false);
+    }
+
+    // for_each
+    {
+        std::vector<bool> v{true, false};
+        std::string result;
+        hana::for_each(v, [&](bool b) { result += to_char(b); });
+        BOOST_HANA_RUNTIME_CHECK(result == "tf");
+
+        // the elements of an lvalue can be modified through the proxy
+        hana::for_each(v, [](auto&& b) { b = !b; });
+        BOOST_HANA_RUNTIME_CHECK(v == std::vector<bool>{false, true});
+    }
+
+    // any_of
+    {
+        BOOST_HANA_RUNTIME_CHECK(hana::any_of(std::vector<bool>{false, true}, [](bool b) { return b; }));
+        BOOST_HANA_RUNTIME_CHECK(!hana::any_of(std::vector<bool>{false}, [](bool b) { return b; }));
+    }
+}
@@ -4,8 +4,12 @@
 
 #include <boost/hana/assert.hpp>
 #include <boost/hana/equal.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/contains.hpp>
 #include <boost/hana/erase_key.hpp>
+#include <boost/hana/insert.hpp>
 #include <boost/hana/map.hpp>
+#include <boost/hana/not.hpp>
 
 #include <laws/base.hpp>
 #include <support/minimal_product.hpp>
@@ -67,4 +71,26 @@ int main() {
         hana::erase_key(hana::make_map(p<1, 1>(), p<2, 2>(), p<3, 3>()), key<3>()),
         hana::make_map(p<1, 1>(), p<2, 2>())
     ));
+
+    // make sure the keys remaining after an erasure can still be looked up
+    {
+        auto map = hana::erase_key(hana::make_map(p<1, 1>(), p<2, 2>(), p<3, 3>()), key<1>());
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(map, key<1>())));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_key(map, key<2>()), val<2>()));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_key(map, key<3>()), val<3>()));
+    }
+
+    // make sure a key can be inserted again after being erased
+    {
+        auto map = hana::insert(
+            hana::erase_key(hana::make_map(p<1, 1>(), p<2, 2>()), key<1>()),
+            p<1, 10>()
+        );
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_key(map, key<1>()), val<10>()));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_key(map, key<2>()), val<2>()));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::erase_key(map, key<1>()),
+            hana::make_map(p<2, 2>())
+        ));
+    }
 }
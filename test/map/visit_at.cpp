@@ -0,0 +1,74 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/visit_at.hpp>
+
+#include <laws/base.hpp>
+
+#include <cstddef>
+#include <string>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+struct index_of {
+    template <int i>
+    constexpr int operator()(ct_eq<i> const&) const { return i; }
+};
+
+struct size_of {
+    int operator()(int) const { return 1; }
+    int operator()(std::string const& s) const { return static_cast<int>(s.size()); }
+};
+
+struct assign {
+    template <typename T>
+    void operator()(T& t) const { t = T{}; }
+};
+
+struct identity {
+    template <typename T>
+    constexpr T operator()(T const& t) const { return t; }
+};
+
+int main() {
+    // values are visited, not keys
+    {
+        auto map = hana::make_map(
+            hana::make_pair(ct_eq<10>{}, ct_eq<0>{}),
+            hana::make_pair(ct_eq<11>{}, ct_eq<1>{}),
+            hana::make_pair(ct_eq<12>{}, ct_eq<2>{})
+        );
+        for (std::size_t n = 0; n != 3; ++n)
+            BOOST_HANA_RUNTIME_CHECK(hana::visit_at(map, n, index_of{}) == static_cast<int>(n));
+    }
+
+    // visiting happens in the order of hana::keys
+    {
+        auto map = hana::make_map(
+            hana::make_pair(hana::int_c<0>, 3),
+            hana::make_pair(hana::int_c<1>, std::string{"hello"})
+        );
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(map, 0, size_of{}) == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(map, 1, size_of{}) == 5);
+
+        hana::visit_at(map, 1, assign{});
+        BOOST_HANA_RUNTIME_CHECK(map[hana::int_c<0>] == 3);
+        BOOST_HANA_RUNTIME_CHECK(map[hana::int_c<1>].empty());
+    }
+
+    // visit_at can be used in a constant expression
+    {
+        constexpr auto map = hana::make_map(
+            hana::make_pair(hana::int_c<0>, 'a'),
+            hana::make_pair(hana::int_c<1>, 'b')
+        );
+        static_assert(hana::visit_at(map, 1, identity{}) == 'b', "");
+    }
+}
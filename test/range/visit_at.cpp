@@ -0,0 +1,31 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/visit_at.hpp>
+
+#include <cstddef>
+namespace hana = boost::hana;
+
+
+struct value_of {
+    template <typename N>
+    constexpr int operator()(N) const { return N::value; }
+};
+
+int main() {
+    {
+        auto r = hana::make_range(hana::int_c<0>, hana::int_c<1>);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(r, 0, value_of{}) == 0);
+    }
+    {
+        auto r = hana::make_range(hana::int_c<4>, hana::int_c<90>);
+        for (std::size_t n = 0; n != 86; ++n)
+            BOOST_HANA_RUNTIME_CHECK(hana::visit_at(r, n, value_of{}) == static_cast<int>(n) + 4);
+    }
+
+    static_assert(hana::visit_at(hana::range_c<int, 3, 8>, 2, value_of{}) == 5, "");
+}
@@ -0,0 +1,89 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/erase_key.hpp>
+#include <boost/hana/hash.hpp>
+#include <boost/hana/insert.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/not.hpp>
+#include <boost/hana/set.hpp>
+namespace hana = boost::hana;
+
+
+struct A { };
+struct B { };
+
+struct the_hash;
+
+namespace boost { namespace hana {
+    template <>
+    struct hash_impl<A> {
+        static constexpr auto apply(A const&) {
+            return hana::type_c<the_hash>;
+        }
+    };
+
+    template <>
+    struct hash_impl<B> {
+        static constexpr auto apply(B const&) {
+            return hana::type_c<the_hash>;
+        }
+    };
+
+    template <>
+    struct equal_impl<A, A> {
+        static constexpr auto apply(A const&, A const&) {
+            return hana::true_c;
+        }
+    };
+
+    template <>
+    struct equal_impl<B, B> {
+        static constexpr auto apply(B const&, B const&) {
+            return hana::true_c;
+        }
+    };
+}}
+
+int main() {
+    constexpr auto key1 = A{};
+    constexpr auto key2 = B{};
+
+    // ensure the hashes actually collide
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::hash(key1), hana::hash(key2)));
+
+    // with make_set
+    {
+        auto set = hana::make_set(key1, hana::int_c<56>, key2);
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(set, key1));
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(set, key2));
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(set, hana::int_c<56>));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(set, hana::int_c<42>)));
+    }
+
+    // with insert
+    {
+        auto set = hana::insert(hana::make_set(key2, hana::int_c<56>), key1);
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(set, key1));
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(set, key2));
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(set, hana::int_c<56>));
+    }
+
+    // with erase_key
+    {
+        auto set = hana::erase_key(hana::make_set(key1, hana::int_c<56>, key2), key1);
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(set, key1)));
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(set, key2));
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(set, hana::int_c<56>));
+    }
+
+    // a key whose hash collides with others without being in the set
+    {
+        auto set = hana::make_set(key1, hana::int_c<56>);
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(set, key2)));
+    }
+}
@@ -0,0 +1,65 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    // with a string separator
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::join(hana::make_tuple(), BOOST_HANA_STRING(", ")),
+            BOOST_HANA_STRING("")
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::join(hana::make_tuple(BOOST_HANA_STRING("a")), BOOST_HANA_STRING(", ")),
+            BOOST_HANA_STRING("a")
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::join(hana::make_tuple(BOOST_HANA_STRING("a"), BOOST_HANA_STRING("bc")),
+                       BOOST_HANA_STRING(", ")),
+            BOOST_HANA_STRING("a, bc")
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::join(hana::make_tuple(BOOST_HANA_STRING(""), BOOST_HANA_STRING(""),
+                                        BOOST_HANA_STRING("")),
+                       BOOST_HANA_STRING(", ")),
+            BOOST_HANA_STRING(", , ")
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::join(hana::make_tuple(BOOST_HANA_STRING("a"), BOOST_HANA_STRING("b")),
+                       BOOST_HANA_STRING("")),
+            BOOST_HANA_STRING("ab")
+        ));
+    }
+
+    // with a character separator
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::join(hana::make_tuple(), hana::char_c<'.'>),
+            BOOST_HANA_STRING("")
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::join(hana::make_tuple(BOOST_HANA_STRING("orders"),
+                                        BOOST_HANA_STRING("eu"),
+                                        BOOST_HANA_STRING("fills")),
+                       hana::char_c<'.'>),
+            BOOST_HANA_STRING("orders.eu.fills")
+        ));
+    }
+
+    // join is the inverse of split
+    {
+        auto topic = BOOST_HANA_STRING(".orders..eu.fills.");
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::join(hana::split(topic, hana::char_c<'.'>), hana::char_c<'.'>),
+            topic
+        ));
+    }
+}
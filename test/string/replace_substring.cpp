@@ -0,0 +1,52 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::replace_substring(BOOST_HANA_STRING(""), BOOST_HANA_STRING("a"), BOOST_HANA_STRING("b")),
+        BOOST_HANA_STRING("")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::replace_substring(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("x"), BOOST_HANA_STRING("y")),
+        BOOST_HANA_STRING("abc")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::replace_substring(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("")),
+        BOOST_HANA_STRING("")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::replace_substring(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("b"), BOOST_HANA_STRING("xyz")),
+        BOOST_HANA_STRING("axyzc")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::replace_substring(BOOST_HANA_STRING("orders.eu.fills"), BOOST_HANA_STRING("."), BOOST_HANA_STRING("::")),
+        BOOST_HANA_STRING("orders::eu::fills")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::replace_substring(BOOST_HANA_STRING("a::b::c"), BOOST_HANA_STRING("::"), BOOST_HANA_STRING(".")),
+        BOOST_HANA_STRING("a.b.c")
+    ));
+
+    // occurrences are replaced from left to right, without overlapping
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::replace_substring(BOOST_HANA_STRING("aaa"), BOOST_HANA_STRING("aa"), BOOST_HANA_STRING("b")),
+        BOOST_HANA_STRING("ba")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::replace_substring(BOOST_HANA_STRING("aaaa"), BOOST_HANA_STRING("aa"), BOOST_HANA_STRING("b")),
+        BOOST_HANA_STRING("bb")
+    ));
+
+    // the replacement is not searched again
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::replace_substring(BOOST_HANA_STRING("ab"), BOOST_HANA_STRING("a"), BOOST_HANA_STRING("aa")),
+        BOOST_HANA_STRING("aab")
+    ));
+}
@@ -0,0 +1,131 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/functional/on.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/less.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/reverse.hpp>
+#include <boost/hana/sort.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+namespace hana = boost::hana;
+
+
+// The sorting algorithm only kicks in for sequences longer than the ones
+// tested in the generic sort tests, so we test longer sequences here.
+
+template <int key, int id>
+constexpr auto p() { return hana::make_pair(hana::int_c<key>, hana::int_c<id>); }
+
+int main() {
+    // sorting a long reversed sequence
+    {
+        constexpr auto xs = hana::unpack(hana::make_range(hana::int_c<0>, hana::int_c<50>),
+                                         hana::make_tuple);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(hana::reverse(xs)),
+            xs
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(xs),
+            xs
+        ));
+    }
+
+    // stability of the sort on a long sequence with many equivalent elements
+    {
+        constexpr auto xs = hana::make_tuple(
+            p<1, 0>(),
+            p<0, 1>(),
+            p<4, 2>(),
+            p<3, 3>(),
+            p<3, 4>(),
+            p<2, 5>(),
+            p<1, 6>(),
+            p<8, 7>(),
+            p<1, 8>(),
+            p<9, 9>(),
+            p<6, 10>(),
+            p<0, 11>(),
+            p<0, 12>(),
+            p<1, 13>(),
+            p<3, 14>(),
+            p<3, 15>(),
+            p<8, 16>(),
+            p<9, 17>(),
+            p<0, 18>(),
+            p<8, 19>(),
+            p<3, 20>(),
+            p<8, 21>(),
+            p<6, 22>(),
+            p<3, 23>(),
+            p<7, 24>(),
+            p<9, 25>(),
+            p<4, 26>(),
+            p<0, 27>(),
+            p<2, 28>(),
+            p<6, 29>(),
+            p<5, 30>(),
+            p<4, 31>(),
+            p<2, 32>(),
+            p<3, 33>(),
+            p<5, 34>(),
+            p<1, 35>(),
+            p<1, 36>(),
+            p<6, 37>(),
+            p<1, 38>(),
+            p<5, 39>()
+        );
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(xs, hana::less ^hana::on^ hana::first),
+            hana::make_tuple(
+                p<0, 1>(),
+                p<0, 11>(),
+                p<0, 12>(),
+                p<0, 18>(),
+                p<0, 27>(),
+                p<1, 0>(),
+                p<1, 6>(),
+                p<1, 8>(),
+                p<1, 13>(),
+                p<1, 35>(),
+                p<1, 36>(),
+                p<1, 38>(),
+                p<2, 5>(),
+                p<2, 28>(),
+                p<2, 32>(),
+                p<3, 3>(),
+                p<3, 4>(),
+                p<3, 14>(),
+                p<3, 15>(),
+                p<3, 20>(),
+                p<3, 23>(),
+                p<3, 33>(),
+                p<4, 2>(),
+                p<4, 26>(),
+                p<4, 31>(),
+                p<5, 30>(),
+                p<5, 34>(),
+                p<5, 39>(),
+                p<6, 10>(),
+                p<6, 22>(),
+                p<6, 29>(),
+                p<6, 37>(),
+                p<7, 24>(),
+                p<8, 7>(),
+                p<8, 16>(),
+                p<8, 19>(),
+                p<8, 21>(),
+                p<9, 9>(),
+                p<9, 17>(),
+                p<9, 25>()
+            )
+        ));
+    }
+}